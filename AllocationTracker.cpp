@@ -0,0 +1,307 @@
+/*
+ * File Title: AllocationTracker.cpp
+ * Author: Mahim Ali
+ * Date: October 19, 2026
+ * This file implements a class called AllocationTracker
+ */
+#include "AllocationTracker.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <mutex>
+#include <new>
+
+// Everything below is reached from operator new, so none of it may allocate: the registry is made of fixed arrays
+// that are initialized before any code runs, and the scope stack is a plain thread_local array.
+static std::mutex registry_mutex;
+static const char *scope_names[AllocationTracker::MAX_SCOPES];
+static std::atomic<int> scope_count{0};
+static double budgets[AllocationTracker::MAX_SCOPES];
+static bool has_budget[AllocationTracker::MAX_SCOPES];
+static std::atomic<int> next_thread_slot{0};
+static std::atomic<std::uint64_t> total_allocations{0};
+static std::atomic<long long> live_bytes{0};
+
+// The operations the calling thread is inside of, innermost last. counted[i] is false for a repeated operation,
+// and for an unregistered one, so their allocations only go to the operations below them.
+struct ScopeStack
+{
+    int scopes[AllocationTracker::MAX_DEPTH];
+    bool counted[AllocationTracker::MAX_DEPTH];
+    int depth;
+};
+static thread_local ScopeStack scope_stack;
+
+/*
+    @return: the counters of every thread slot
+*/
+AllocationTracker::ThreadCounters *AllocationTracker::allCounters()
+{
+    static ThreadCounters counters[MAX_THREADS];
+    return counters;
+}
+
+/*
+    @return: the counters of the calling thread's slot
+*/
+AllocationTracker::ThreadCounters &AllocationTracker::localCounters()
+{
+    thread_local int slot = -1;
+    if (slot < 0)
+    {
+        slot = next_thread_slot.fetch_add(1, std::memory_order_relaxed) % MAX_THREADS;
+    }
+    return allCounters()[slot];
+}
+
+/*
+    @param: the id of an operation
+    @post: calls, allocations and bytes are the figures of the operation summed over every thread slot
+*/
+void AllocationTracker::sumScope(int scope, std::uint64_t &calls, std::uint64_t &allocations, std::uint64_t &bytes)
+{
+    calls = allocations = bytes = 0;
+    for (int slot = 0; slot < MAX_THREADS; slot++)
+    {
+        const ScopeCounters &counters = allCounters()[slot].scopes_[scope];
+        calls += counters.calls_.load(std::memory_order_relaxed);
+        allocations += counters.allocations_.load(std::memory_order_relaxed);
+        bytes += counters.bytes_.load(std::memory_order_relaxed);
+    }
+}
+
+/*
+    @param: the name of an operation, which must outlive the program (a string literal)
+    @return: the id of the name, registering it the first time; -1 if MAX_SCOPES names are already registered
+*/
+int AllocationTracker::registerScope(const char *name)
+{
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    int count = scope_count.load(std::memory_order_relaxed);
+    for (int i = 0; i < count; i++)
+    {
+        if (std::strcmp(scope_names[i], name) == 0) // the same name used in two places shares one scope
+        {
+            return i;
+        }
+    }
+    if (count == MAX_SCOPES)
+    {
+        return -1;
+    }
+    scope_names[count] = name;
+    scope_count.store(count + 1, std::memory_order_release);
+    return count;
+}
+
+/*
+    @param: the name of an operation, and the most allocations one call of it may make on average
+    @post: the budget is checked by checkBudgets()
+*/
+void AllocationTracker::setBudget(const char *name, double allocations_per_operation)
+{
+    int scope = registerScope(name);
+    if (scope < 0)
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    budgets[scope] = allocations_per_operation;
+    has_budget[scope] = true;
+}
+
+/*
+    @param: an output stream
+    @return: false if any operation made more allocations per call than its budget, true otherwise
+*/
+bool AllocationTracker::checkBudgets(std::ostream &out)
+{
+    bool within = true;
+    int count = scope_count.load(std::memory_order_acquire);
+    for (int scope = 0; scope < count; scope++)
+    {
+        std::uint64_t calls, allocations, bytes;
+        sumScope(scope, calls, allocations, bytes);
+        if (!has_budget[scope] || calls == 0)
+        {
+            continue;
+        }
+        double per_call = double(allocations) / calls;
+        if (per_call > budgets[scope])
+        {
+            out << scope_names[scope] << " over budget: " << std::fixed << std::setprecision(2) << per_call
+                << " allocs/op (budget " << budgets[scope] << ")" << std::endl;
+            within = false;
+        }
+    }
+    return within;
+}
+
+/*
+    @param: an output stream
+    @post: prints, for each operation that ran, its calls, allocations and bytes, in total and per call
+*/
+void AllocationTracker::report(std::ostream &out)
+{
+    int count = scope_count.load(std::memory_order_acquire);
+    for (int scope = 0; scope < count; scope++)
+    {
+        std::uint64_t calls, allocations, bytes;
+        sumScope(scope, calls, allocations, bytes);
+        if (calls == 0)
+        {
+            continue;
+        }
+        out << std::left << std::setw(40) << scope_names[scope] << std::right << " calls: " << calls
+            << " allocs: " << allocations << " (" << std::fixed << std::setprecision(2) << double(allocations) / calls << "/op)"
+            << " bytes: " << bytes << " (" << double(bytes) / calls << "/op)" << std::endl;
+    }
+}
+
+/*
+    @post: sets the calls, allocations and bytes of every operation back to 0
+*/
+void AllocationTracker::reset()
+{
+    for (int slot = 0; slot < MAX_THREADS; slot++)
+    {
+        for (ScopeCounters &counters : allCounters()[slot].scopes_)
+        {
+            counters.calls_.store(0, std::memory_order_relaxed);
+            counters.allocations_.store(0, std::memory_order_relaxed);
+            counters.bytes_.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+/*
+    @return: the number of allocations made by the whole process
+*/
+std::uint64_t AllocationTracker::totalAllocations()
+{
+    return total_allocations.load(std::memory_order_relaxed);
+}
+
+/*
+    @return: the bytes the whole process has allocated and not yet freed
+*/
+long long AllocationTracker::liveBytes()
+{
+    return live_bytes.load(std::memory_order_relaxed);
+}
+
+/*
+    @param: the size of a new block
+    @post: adds the allocation to the process totals and to every counted scope on the calling thread's stack
+*/
+void AllocationTracker::recordAllocation(std::size_t size)
+{
+    total_allocations.fetch_add(1, std::memory_order_relaxed);
+    live_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (scope_stack.depth == 0)
+    {
+        return;
+    }
+    ThreadCounters &counters = localCounters();
+    for (int i = 0; i < scope_stack.depth && i < MAX_DEPTH; i++)
+    {
+        if (scope_stack.counted[i])
+        {
+            counters.scopes_[scope_stack.scopes[i]].allocations_.fetch_add(1, std::memory_order_relaxed);
+            counters.scopes_[scope_stack.scopes[i]].bytes_.fetch_add(size, std::memory_order_relaxed);
+        }
+    }
+}
+
+/*
+    @param: the size of a block being freed
+    @post: takes the block off the bytes the process has allocated
+*/
+void AllocationTracker::recordRelease(std::size_t size)
+{
+    live_bytes.fetch_sub(size, std::memory_order_relaxed);
+}
+
+/*
+    @param: the id of an operation
+    @post: pushes the operation on the calling thread's scope stack and counts one call of it,
+           unless it is already on the stack
+*/
+AllocationTracker::Scope::Scope(int scope)
+{
+    int depth = scope_stack.depth++;
+    if (depth >= MAX_DEPTH)
+    {
+        return; // too deep to record, but still counted in the scopes below
+    }
+    bool counted = scope >= 0;
+    for (int i = 0; i < depth && counted; i++)
+    {
+        counted = !(scope_stack.counted[i] && scope_stack.scopes[i] == scope);
+    }
+    scope_stack.scopes[depth] = scope;
+    scope_stack.counted[depth] = counted;
+    if (counted)
+    {
+        localCounters().scopes_[scope].calls_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+/*
+    @post: pops the operation off the calling thread's scope stack
+*/
+AllocationTracker::Scope::~Scope()
+{
+    scope_stack.depth--;
+}
+
+#if defined(RPG_TRACK_ALLOCATIONS) || defined(RPG_COUNT_ALLOCATIONS)
+// Every global allocation and deallocation form is replaced here, and only here, so the sized and array forms
+// cannot reach a block through the default allocator. Each block records its size in a header in front of it,
+// so operator delete can take it off liveBytes().
+static const std::size_t HEADER_SIZE = alignof(std::max_align_t);
+
+void *operator new(std::size_t size)
+{
+    char *block = static_cast<char *>(std::malloc(HEADER_SIZE + size));
+    if (block == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    *reinterpret_cast<std::size_t *>(block) = size;
+    AllocationTracker::recordAllocation(size);
+    return block + HEADER_SIZE;
+}
+
+void *operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+    char *block = static_cast<char *>(ptr) - HEADER_SIZE;
+    AllocationTracker::recordRelease(*reinterpret_cast<std::size_t *>(block));
+    std::free(block);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    operator delete(ptr);
+}
+
+// the header already holds the size, so the sized forms ignore theirs
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    operator delete(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept
+{
+    operator delete(ptr);
+}
+#endif
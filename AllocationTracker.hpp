@@ -0,0 +1,127 @@
+/*
+ * File Title: AllocationTracker.hpp
+ * Author: Mahim Ali
+ * Date: October 19, 2026
+ * This file is the interface of a class called AllocationTracker
+ */
+#ifndef ALLOCATION_TRACKER_HPP
+#define ALLOCATION_TRACKER_HPP
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+/*
+    Attributes heap allocations to the gameplay operation that made them.
+
+    An operation is marked with RPG_ALLOCATION_SCOPE("Tavern::createCombatQueue"); at the top of its body.
+    When the program is built with -DRPG_TRACK_ALLOCATIONS, AllocationTracker.cpp replaces the global operator new
+    and delete, and every allocation is added to each operation on the calling thread's scope stack, so an operation's
+    figures include the operations it calls. An operation that (directly or through recursion) runs inside itself
+    is only counted once. Built with -DRPG_COUNT_ALLOCATIONS instead, the operators are still replaced but the macro
+    compiles to nothing, so only the process totals are kept. Without either flag operator new is left alone.
+
+    report() prints allocations and bytes per operation, and checkBudgets() compares them with the
+    budgets given to setBudget(), so a test or benchmark can fail when a hot path starts allocating.
+*/
+class AllocationTracker
+{
+public:
+    static const int MAX_SCOPES = 64;  // most distinct operation names; later names are not tracked
+    static const int MAX_DEPTH = 32;   // deepest scope stack tracked per thread
+    static const int MAX_THREADS = 64; // threads beyond this share counters (still counted correctly)
+
+    /*
+    @param: the name of an operation, which must outlive the program (a string literal)
+    @return: the id of the name, registering it the first time; -1 if MAX_SCOPES names are already registered
+    */
+    static int registerScope(const char *name);
+
+    /*
+    @param: the name of an operation, and the most allocations one call of it may make on average
+    @post: the budget is checked by checkBudgets(); a budget of 0 asks for an operation that never allocates
+    */
+    static void setBudget(const char *name, double allocations_per_operation);
+
+    /*
+    @param: an output stream
+    @return: false if any operation made more allocations per call than its budget, true otherwise
+    @post: prints "[NAME] over budget: [ALLOCATIONS] allocs/op (budget [BUDGET])" for each such operation
+    */
+    static bool checkBudgets(std::ostream &out);
+
+    /*
+    @param: an output stream
+    @post: prints, for each operation that ran, its calls, allocations and bytes, in total and per call:
+           "[NAME] calls: [CALLS] allocs: [ALLOCATIONS] ([PER CALL]/op) bytes: [BYTES] ([PER CALL]/op)"
+    */
+    static void report(std::ostream &out);
+
+    /*
+    @post: sets the calls, allocations and bytes of every operation back to 0. Budgets are kept.
+    */
+    static void reset();
+
+    /*
+    @return: the number of allocations made by the whole process, and the bytes it has allocated and not yet freed.
+             Both are 0 unless the program is built with RPG_TRACK_ALLOCATIONS or RPG_COUNT_ALLOCATIONS.
+    */
+    static std::uint64_t totalAllocations();
+    static long long liveBytes();
+
+    /*
+    @param: the size of a new block, or of a block being freed
+    @post: adds the allocation to the process totals and to every scope on the calling thread's stack.
+           Called by the replaced operator new and delete.
+    */
+    static void recordAllocation(std::size_t size);
+    static void recordRelease(std::size_t size);
+
+    /*
+        Pushes an operation on the calling thread's scope stack for as long as it lives.
+    */
+    class Scope
+    {
+    public:
+        Scope(int scope);
+        ~Scope();
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+    };
+
+private:
+    // The figures of one operation.
+    struct ScopeCounters
+    {
+        std::atomic<std::uint64_t> calls_{0};
+        std::atomic<std::uint64_t> allocations_{0};
+        std::atomic<std::uint64_t> bytes_{0};
+    };
+
+    // The figures of every operation for the threads that share one slot, on their own cache lines.
+    struct alignas(64) ThreadCounters
+    {
+        ScopeCounters scopes_[MAX_SCOPES];
+    };
+
+    static ThreadCounters *allCounters();
+    static ThreadCounters &localCounters();
+
+    // Helper Function: sums the figures of one operation over every thread slot
+    static void sumScope(int scope, std::uint64_t &calls, std::uint64_t &allocations, std::uint64_t &bytes);
+};
+
+#ifdef RPG_TRACK_ALLOCATIONS
+#define RPG_ALLOCATION_SCOPE_JOIN_(a, b) a##b
+#define RPG_ALLOCATION_SCOPE_JOIN(a, b) RPG_ALLOCATION_SCOPE_JOIN_(a, b)
+#define RPG_ALLOCATION_SCOPE(name)                                                                                          \
+    static const int RPG_ALLOCATION_SCOPE_JOIN(rpg_allocation_scope_, __LINE__) = AllocationTracker::registerScope(name); \
+    AllocationTracker::Scope RPG_ALLOCATION_SCOPE_JOIN(rpg_allocation_frame_, __LINE__)(RPG_ALLOCATION_SCOPE_JOIN(rpg_allocation_scope_, __LINE__))
+#else
+#define RPG_ALLOCATION_SCOPE(name) \
+    do                             \
+    {                              \
+    } while (false)
+#endif
+
+#endif // ALLOCATION_TRACKER_HPP
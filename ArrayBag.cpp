@@ -6,12 +6,69 @@
  */
 #include "ArrayBag.hpp"
 
-/** default constructor**/
+/**
+ @param the most entries the bag may hold
+ @post an empty bag, with no storage until the first entry is added
+ **/
 template <class ItemType>
-ArrayBag<ItemType>::ArrayBag() : item_count_(0)
+ArrayBag<ItemType>::ArrayBag(int capacity) : capacity_(capacity), item_count_(0)
 {
 } // end default constructor
 
+/**
+ @post a copy of rhs's entries, capacity and handles
+ **/
+template <class ItemType>
+ArrayBag<ItemType>::ArrayBag(const ArrayBag<ItemType> &rhs)
+    : capacity_(rhs.capacity_), item_count_(rhs.item_count_), slots_(rhs.slots_), dense_index_(rhs.dense_index_), generations_(rhs.generations_)
+{
+   items_.grow(slots_.size(), 0);
+   items_.putAll(0, rhs.items_.data(), item_count_);
+} // end copy constructor
+
+/**
+ @post a copy of rhs's entries, capacity and handles, in the storage this bag already has when it is large enough
+ **/
+template <class ItemType>
+ArrayBag<ItemType> &ArrayBag<ItemType>::operator=(const ArrayBag<ItemType> &rhs)
+{
+   if (this != &rhs)
+   {
+      capacity_ = rhs.capacity_;
+      int slot_count = rhs.slots_.size();
+      if (int(slots_.size()) < slot_count || int(slots_.size()) > capacity_)
+      {
+         slots_ = rhs.slots_;
+         dense_index_ = rhs.dense_index_;
+         generations_ = rhs.generations_;
+         items_.grow(slot_count, 0);
+      }
+      else // this bag has more slots: rhs's are copied over the first ones and the rest are free
+      {
+         std::copy(rhs.slots_.begin(), rhs.slots_.end(), slots_.begin());
+         std::copy(rhs.dense_index_.begin(), rhs.dense_index_.end(), dense_index_.begin());
+         std::copy(rhs.generations_.begin(), rhs.generations_.end(), generations_.begin());
+         for (int slot = slot_count; slot < int(slots_.size()); slot++)
+         {
+            slots_[slot] = slot;
+            dense_index_[slot] = -1;
+         }
+      }
+      items_.putAll(0, rhs.items_.data(), rhs.item_count_);
+      item_count_ = rhs.item_count_;
+   }
+   return *this;
+} // end operator=
+
+/**
+ @return the most entries the bag may hold
+ **/
+template <class ItemType>
+int ArrayBag<ItemType>::getCapacity() const
+{
+   return capacity_;
+} // end getCapacity
+
 /**
  @return item_count_ : the current size of the bag
  **/
@@ -36,15 +93,36 @@ bool ArrayBag<ItemType>::isEmpty() const
 template <class ItemType>
 bool ArrayBag<ItemType>::add(const ItemType &new_entry)
 {
-   bool has_room = (item_count_ < DEFAULT_CAPACITY);
-   if (has_room)
+   BagHandle handle;
+   return add(new_entry, handle);
+} // end add
+
+/**
+ @param a reference to a handle, set to the handle of new_entry when it is added
+ @return true if new_entry was successfully added to items_, false otherwise
+ **/
+template <class ItemType>
+bool ArrayBag<ItemType>::add(const ItemType &new_entry, BagHandle &handle)
+{
+   int count = item_count_;
+   if (count == int(slots_.size())) // every slot is in use: grow, unless the bag is at its capacity
    {
-      items_[item_count_] = new_entry;
-      item_count_++;
-      return true;
+      if (count >= capacity_)
+      {
+         return false;
+      }
+      ItemType entry = new_entry; // new_entry may be in this bag, and growing moves the entries
+      reserve(count + 1);
+      return add(entry, handle);
    } // end if
 
-   return false;
+   int slot = slots_[count]; // the first free slot
+   dense_index_[slot] = count;
+   items_.put(count, new_entry);
+   item_count_ = count + 1;
+   handle.slot_ = slot;
+   handle.generation_ = generations_[slot];
+   return true;
 } // end add
 
 /**
@@ -57,19 +135,55 @@ bool ArrayBag<ItemType>::remove(const ItemType &an_entry)
    bool can_remove = !isEmpty() && (found_index > -1);
    if (can_remove)
    {
-      item_count_--;
-      items_[found_index] = items_[item_count_];
+      removeAt(found_index);
    } // end if
 
    return can_remove;
 } // end remove
 
+/**
+ @return true if the entry of the handle was still in the bag and has been removed, false otherwise
+ **/
+template <class ItemType>
+bool ArrayBag<ItemType>::remove(const BagHandle &handle)
+{
+   int found_index = getIndexOf(handle);
+   if (found_index > -1)
+   {
+      removeAt(found_index);
+   } // end if
+
+   return found_index > -1;
+} // end remove
+
+/**
+ @param an index in [0, item_count_)
+ @post the entry at the index is removed: the last entry moves into its place and its slot is freed
+ **/
+template <class ItemType>
+void ArrayBag<ItemType>::removeAt(int index)
+{
+   item_count_--;
+   int freed = slots_[index];
+   items_[index] = items_[item_count_];
+   slots_[index] = slots_[item_count_];
+   dense_index_[slots_[index]] = index;
+   slots_[item_count_] = freed; // the freed slot joins the free ones after the live entries
+   dense_index_[freed] = -1;
+   generations_[freed]++;
+} // end removeAt
+
 /**
  @post item_count_ == 0
  **/
 template <class ItemType>
 void ArrayBag<ItemType>::clear()
 {
+   for (int i = 0; i < item_count_; i++)
+   {
+      dense_index_[slots_[i]] = -1;
+      generations_[slots_[i]]++;
+   }
    item_count_ = 0;
 } // end clear
 
@@ -103,8 +217,113 @@ bool ArrayBag<ItemType>::contains(const ItemType &an_entry) const
    return getIndexOf(an_entry) > -1;
 } // end contains
 
+/**
+ @return true if the entry of the handle is still in the bag, false otherwise
+ **/
+template <class ItemType>
+bool ArrayBag<ItemType>::contains(const BagHandle &handle) const
+{
+   return getIndexOf(handle) > -1;
+} // end contains
+
+/**
+ @param a reference to store the entry of the handle in
+ @return true if the entry of the handle is still in the bag and was stored in entry, false otherwise
+ **/
+template <class ItemType>
+bool ArrayBag<ItemType>::getEntry(const BagHandle &handle, ItemType &entry) const
+{
+   int found_index = getIndexOf(handle);
+   if (found_index > -1)
+   {
+      entry = items_[found_index];
+   }
+   return found_index > -1;
+} // end getEntry
+
+/**
+ @param an index in [0, getCurrentSize())
+ @return the handle of the entry at the index of toVector()
+ **/
+template <class ItemType>
+BagHandle ArrayBag<ItemType>::getHandle(int index) const
+{
+   BagHandle handle;
+   handle.slot_ = slots_[index];
+   handle.generation_ = generations_[handle.slot_];
+   return handle;
+} // end getHandle
+
 // ********* PRIVATE METHODS **************//
 
+/**
+   @param the entries to add, and their number. Entries from this bag must be taken after reserve() has made room for them.
+   @post as many of the entries as fit are appended in one copy, each in the next free slot
+ **/
+template <class ItemType>
+void ArrayBag<ItemType>::appendAll(const ItemType *entries, int count)
+{
+   if (count > capacity_ - item_count_)
+   {
+      count = capacity_ - item_count_;
+   }
+   // the caller has made room, so entries from this bag have not moved; they lie before item_count_,
+   // so they never overlap the copy
+   reserve(item_count_ + count);
+   items_.putAll(item_count_, entries, count);
+   for (int i = item_count_; i < item_count_ + count; i++)
+   {
+      dense_index_[slots_[i]] = i;
+   }
+   item_count_ += count;
+} // end appendAll
+
+/**
+   @return the index in items_ of the entry of the handle, or -1 if the handle is stale
+ **/
+template <class ItemType>
+int ArrayBag<ItemType>::getIndexOf(const BagHandle &handle) const
+{
+   if (handle.slot_ < 0 || handle.slot_ >= int(generations_.size()) || generations_[handle.slot_] != handle.generation_)
+   {
+      return -1;
+   }
+   return dense_index_[handle.slot_];
+} // end getIndexOf
+
+/**
+   @param the number of entries the bag must have room for, at most capacity_
+   @post items_ and the slot arrays hold at least that many entries, doubling as they grow; the new slots are free
+ **/
+template <class ItemType>
+void ArrayBag<ItemType>::reserve(int count)
+{
+   int slot_count = slots_.size();
+   if (count <= slot_count)
+   {
+      return;
+   }
+   int capacity = (slot_count == 0) ? 16 : 2 * slot_count;
+   if (capacity < count)
+   {
+      capacity = count;
+   }
+   if (capacity > capacity_)
+   {
+      capacity = capacity_;
+   }
+   items_.grow(capacity, item_count_);
+   // every slot in use is listed before item_count_, so the new slots can join the free ones at the end
+   slots_.resize(capacity);
+   dense_index_.resize(capacity);
+   generations_.resize(capacity);
+   for (int slot = slot_count; slot < capacity; slot++)
+   {
+      slots_[slot] = slot;
+      dense_index_[slot] = -1;
+   }
+} // end reserve
+
 /**
    @param target to be found in items_
    @return either the index target in the array items_ or -1,
@@ -140,13 +359,18 @@ int ArrayBag<ItemType>::getIndexOf(const ItemType &target) const
 template <class ItemType>
 std::vector<ItemType> ArrayBag<ItemType>::toVector() const
 {
-   std::vector<ItemType> bag_contents;
-   for (int i = 0; i < item_count_; i++)
-      bag_contents.push_back(items_[i]);
-
-   return bag_contents;
+   return std::vector<ItemType>(items_.data(), items_.data() + item_count_);
 } // end toVector
 
+/**
+ @return a view of the contents of items_, in the order of toVector(), without copying them
+ **/
+template <class ItemType>
+ArrayBagView<ItemType> ArrayBag<ItemType>::view() const
+{
+   return ArrayBagView<ItemType>{items_.data(), item_count_};
+} // end view
+
 /** @param:   A reference to another ArrayBag object
     @post:    Combines the contents from both ArrayBag objects, EXCLUDING duplicates.
     Example: [1, 2, 3] /= [1, 4] will produce [1, 2, 3, 4]
@@ -154,24 +378,19 @@ std::vector<ItemType> ArrayBag<ItemType>::toVector() const
 template <class ItemType>
 void ArrayBag<ItemType>::operator/=(const ArrayBag<ItemType> &rhs)
 {
-   int index = 0;
+   // Room is made once up front; the new entries are then appended in place, and each one found
+   // is checked against the ones appended before it like the entries already in the bag
    int itemsToAdd = rhs.item_count_;
-   while (itemsToAdd > 0)
+   reserve((itemsToAdd > capacity_ - item_count_) ? capacity_ : item_count_ + itemsToAdd);
+   for (int index = 0; index < itemsToAdd && item_count_ < capacity_; index++)
    {
-      if (this->item_count_ == DEFAULT_CAPACITY)
+      const ItemType &entry = rhs.items_[index];
+      if (!contains(entry))
       {
-         break;
+         dense_index_[slots_[item_count_]] = item_count_;
+         items_.put(item_count_, entry);
+         item_count_++;
       }
-      if (contains(rhs.items_[index]))
-      {
-         index++;
-         itemsToAdd--;
-         continue;
-      }
-      this->add(rhs.items_[index]);
-
-      index++;
-      itemsToAdd--;
    }
 }
 
@@ -183,16 +402,7 @@ void ArrayBag<ItemType>::operator/=(const ArrayBag<ItemType> &rhs)
 template <class ItemType>
 void ArrayBag<ItemType>::operator+=(const ArrayBag<ItemType> &rhs)
 {
-   int index = 0;
    int itemsToAdd = rhs.item_count_;
-   while (itemsToAdd > 0)
-   {
-      if (item_count_ == DEFAULT_CAPACITY)
-      {
-         break;
-      }
-      add(rhs.items_[index]);
-      index++;
-      itemsToAdd--;
-   }
+   reserve((itemsToAdd > capacity_ - item_count_) ? capacity_ : item_count_ + itemsToAdd); // before taking rhs's entries, which may be this bag's
+   appendAll(rhs.items_.data(), itemsToAdd);
 }
\ No newline at end of file
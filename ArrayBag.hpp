@@ -6,16 +6,155 @@
  */
 #ifndef ARRAY_BAG_
 #define ARRAY_BAG_
+#include <algorithm>
+#include <cstring>
 #include <iostream>
+#include <memory>
+#include <new>
+#include <type_traits>
 #include <vector>
 
+/**
+    A stable reference to one entry of an ArrayBag, returned when the entry is added.
+    It stays valid while the entry is in the bag, however the other entries move,
+    and is recognised as stale once the entry is removed (its slot's generation has moved on).
+**/
+struct BagHandle
+{
+    int slot_ = -1;           // the slot of the entry, -1 for a handle that never referred to one
+    unsigned generation_ = 0; // the generation of the slot when the entry was added
+};
+
+/**
+    A read-only view of the entries of an ArrayBag, in the order of toVector(), without copying them.
+    It is invalidated by any change to the bag.
+**/
+template <class ItemType>
+struct ArrayBagView
+{
+    const ItemType *data_; // the first entry
+    int size_;             // the number of entries
+
+    const ItemType *begin() const { return data_; }
+    const ItemType *end() const { return data_ + size_; }
+    int size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    const ItemType &operator[](int index) const { return data_[index]; }
+};
+
+/**
+    The storage of an ArrayBag. This general version keeps its entries in a vector, which
+    default-constructs every entry, and copies them one at a time.
+**/
+template <class ItemType, bool TriviallyCopyable = std::is_trivially_copyable<ItemType>::value>
+struct BagSlots
+{
+    std::vector<ItemType> items_;
+
+    ItemType &operator[](int index) { return items_[index]; }
+    const ItemType &operator[](int index) const { return items_[index]; }
+    const ItemType *data() const { return items_.data(); }
+    int capacity() const { return items_.size(); }
+
+    /**
+        @post there is room for at least capacity entries, and the first count are kept
+    **/
+    void grow(int capacity, int)
+    {
+        if (capacity > int(items_.size()))
+        {
+            items_.resize(capacity);
+        }
+    }
+
+    /**
+        @post entry is stored at the index
+    **/
+    void put(int index, const ItemType &entry) { items_[index] = entry; }
+
+    /**
+        @post count entries of source are stored from the index on; source must not overlap them
+    **/
+    void putAll(int index, const ItemType *source, int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            items_[index + i] = source[i];
+        }
+    }
+};
+
+/**
+    The storage for pointers and other trivially copyable entries: left uninitialized until an entry
+    is added, and filled and grown with memcpy in bulk. Not copyable; ArrayBag copies only the entries in use.
+**/
+template <class ItemType>
+struct BagSlots<ItemType, true>
+{
+    ItemType *items_ = nullptr;
+    int capacity_ = 0;
+
+    BagSlots() {}
+    BagSlots(const BagSlots &) = delete;
+    BagSlots &operator=(const BagSlots &) = delete;
+    ~BagSlots() { std::allocator<ItemType>().deallocate(items_, capacity_); }
+
+    ItemType &operator[](int index) { return items_[index]; }
+    const ItemType &operator[](int index) const { return items_[index]; }
+    const ItemType *data() const { return items_; }
+    int capacity() const { return capacity_; }
+
+    void grow(int capacity, int count)
+    {
+        if (capacity <= capacity_)
+        {
+            return;
+        }
+        ItemType *items = std::allocator<ItemType>().allocate(capacity);
+        if (count > 0)
+        {
+            std::memcpy(static_cast<void *>(items), items_, count * sizeof(ItemType));
+        }
+        std::allocator<ItemType>().deallocate(items_, capacity_);
+        items_ = items;
+        capacity_ = capacity;
+    }
+
+    void put(int index, const ItemType &entry) { ::new (static_cast<void *>(items_ + index)) ItemType(entry); }
+
+    void putAll(int index, const ItemType *source, int count)
+    {
+        if (count > 0)
+        {
+            std::memcpy(static_cast<void *>(items_ + index), source, count * sizeof(ItemType));
+        }
+    }
+};
+
 template <class ItemType>
 class ArrayBag
 {
 
 public:
-    /** default constructor**/
-    ArrayBag();
+    static const int DEFAULT_CAPACITY = 100; // max size of items_ at 100 by default for this project
+
+    /**
+        @param the most entries the bag may hold (DEFAULT_CAPACITY by default)
+        @post an empty bag. No storage is allocated until the first entry is added; it then doubles as
+              the bag fills, up to the capacity, so a large capacity costs nothing while it is unused.
+    **/
+    ArrayBag(int capacity = DEFAULT_CAPACITY);
+
+    /**
+        @post a copy of rhs's entries, capacity and handles. Assignment reuses the storage this bag already has.
+    **/
+    ArrayBag(const ArrayBag<ItemType> &rhs);
+    ArrayBag<ItemType> &operator=(const ArrayBag<ItemType> &rhs);
+
+    /**
+        @return the most entries the bag may hold
+    **/
+    int getCapacity() const;
 
     /**
         @return item_count_ : the current size of the bag
@@ -32,11 +171,40 @@ public:
     **/
     bool add(const ItemType &new_entry);
 
+    /**
+        @param a reference to a handle, set to the handle of new_entry when it is added
+        @return true if new_entry was successfully added to items_, false otherwise
+    **/
+    bool add(const ItemType &new_entry, BagHandle &handle);
+
     /**
         @return true if an_entry was successfully removed from items_, false otherwise
        **/
     bool remove(const ItemType &an_entry);
 
+    /**
+        @return true if the entry of the handle was still in the bag and has been removed, false otherwise
+        @post the entry is removed in O(1), without searching: the last entry moves into its place
+       **/
+    bool remove(const BagHandle &handle);
+
+    /**
+        @return true if the entry of the handle is still in the bag, false otherwise
+       **/
+    bool contains(const BagHandle &handle) const;
+
+    /**
+        @param a reference to store the entry of the handle in
+        @return true if the entry of the handle is still in the bag and was stored in entry, false otherwise
+       **/
+    bool getEntry(const BagHandle &handle, ItemType &entry) const;
+
+    /**
+        @param an index in [0, getCurrentSize())
+        @return the handle of the entry at the index of toVector()
+       **/
+    BagHandle getHandle(int index) const;
+
     /**
         @post item_count_ == 0
        **/
@@ -57,6 +225,11 @@ public:
       **/
     std::vector<ItemType> toVector() const;
 
+    /**
+      @return a view of the contents of items_, in the order of toVector(), without copying them
+      **/
+    ArrayBagView<ItemType> view() const;
+
     /**
      @param:   A reference to another ArrayBag object
     @post:    Combines the contents from both ArrayBag objects, including duplicates.
@@ -71,9 +244,16 @@ public:
     void operator+=(const ArrayBag<ItemType> &rhs);
 
 protected:
-    static const int DEFAULT_CAPACITY = 100; // max size of items_ at 100 by default for this project
-    ItemType items_[DEFAULT_CAPACITY];       // Array of bag items
-    int item_count_;                         // Current count of bag items
+    int capacity_;             // the most entries the bag may hold
+    BagSlots<ItemType> items_; // Array of bag items, uninitialized for trivially copyable types
+    int item_count_;           // Current count of bag items
+
+    // Every entry lives in one of slots_.size() slots (items_ has room for at least as many), which keep their number
+    // while the entries move in items_.
+    // slots_ lists every slot: slots_[i] for i < item_count_ is the slot of items_[i], and the rest are free.
+    std::vector<int> slots_;
+    std::vector<int> dense_index_;       // index in items_ of the entry in each slot, -1 for a free slot
+    std::vector<unsigned> generations_;  // advanced each time a slot is freed, to recognise stale handles
 
     /**
         @param target to be found in items_
@@ -82,6 +262,29 @@ protected:
        **/
     int getIndexOf(const ItemType &target) const;
 
+    /**
+        @param an index in [0, item_count_)
+        @post the entry at the index is removed: the last entry moves into its place and its slot is freed
+       **/
+    void removeAt(int index);
+
+    /**
+        @param the entries to add, which may be in this bag, and their number
+        @post as many of the entries as fit are appended in one copy, each in the next free slot
+       **/
+    void appendAll(const ItemType *entries, int count);
+
+    /**
+        @return the index in items_ of the entry of the handle, or -1 if the handle is stale
+       **/
+    int getIndexOf(const BagHandle &handle) const;
+
+    /**
+        @param the number of entries the bag must have room for, at most capacity_
+        @post items_ and the slot arrays hold at least that many entries; the new slots are free
+       **/
+    void reserve(int count);
+
 }; // end ArrayBag
 
 #include "ArrayBag.cpp"
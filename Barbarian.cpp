@@ -199,7 +199,7 @@ void Barbarian::display() const
     If they have now become enraged, the offhand weapon is replaced with "TABLE".
     If they are now not enraged, the main weapon is replaced with "BUCKET".
 */
-void Barbarian::eatTaintedStew()
+void Barbarian::eatTaintedStew(std::mt19937 &)
 {
     int vitality_points = getVitality();
     if (getRace() == "HUMAN" || getRace() == "NONE" || getRace() == "ELF" || getRace() == "DWARF" || getRace() == "LIZARD") // If the Barbarian character doesn't have race of "UNDEAD" then vitality is set to 1.
@@ -221,4 +221,12 @@ void Barbarian::eatTaintedStew()
         vitality_points += 3;
     }
     setVitality(vitality_points);
-}
\ No newline at end of file
+}
+
+/**
+@return: BARBARIAN
+*/
+Subclass Barbarian::getSubclass() const
+{
+    return BARBARIAN;
+}
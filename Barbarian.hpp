@@ -120,7 +120,12 @@ public:
     If they have now become enraged, the offhand weapon is replaced with "TABLE".
     If they are now not enraged, the main weapon is replaced with "BUCKET".
     */
-    void eatTaintedStew() override;
+    void eatTaintedStew(std::mt19937 &random) override;
+
+    /**
+    @return: BARBARIAN
+    */
+    Subclass getSubclass() const override;
 };
 
 #endif
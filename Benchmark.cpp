@@ -0,0 +1,1153 @@
+/*
+ * File Title: Benchmark.cpp
+ * Author: Mahim Ali
+ * Date: October 19, 2026
+ * This file is a self-contained benchmark driver for the game's containers.
+ * Build: make benchmark (see the Makefile for the sources and flags)
+ * Usage: ./benchmark [results.json] [group]
+ *        Every timed operation is also written to results.json, when given, so two builds can be diffed.
+ *        When a group is given (e.g. "tavern" or "quests"), only the benchmarks of that group are run.
+ *        All data comes from a DataGenerator with a fixed seed, so every run works on the same input.
+ *        Built with -DRPG_INSTRUMENTATION, it also prints the Instrumentation report of the instrumented functions.
+ *        Built with -DRPG_TRACK_ALLOCATIONS, it prints the allocations of each tracked operation and exits with 1
+ *        if a hot path breaks its allocation budget.
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "AllocationTracker.hpp"
+#include "DataGenerator.hpp"
+#include "Inventory.hpp"
+#include "QuestList.hpp"
+#include "QuestStore.hpp"
+#include "World.hpp"
+#include "ConcurrentTavern.hpp"
+
+// AllocationTracker replaces operator new and keeps the process totals; the Makefile builds the benchmark with
+// -DRPG_COUNT_ALLOCATIONS, so every benchmark can report the allocations of one operation and the bytes still allocated.
+unsigned long long allocationCount()
+{
+    return AllocationTracker::totalAllocations();
+}
+
+long long liveBytes()
+{
+    return AllocationTracker::liveBytes();
+}
+
+struct BenchResult
+{
+    std::string name_;      // name of the benchmarked operation
+    long long operations_;  // number of times the operation was run
+    double nanoseconds_;    // total wall time of all operations
+    unsigned long long allocations_; // heap allocations made by all operations
+};
+
+/**
+    @param: a number
+    @return: a distinct uppercase, alphabetical item name for the number
+*/
+std::string itemName(int n)
+{
+    return DataGenerator::uniqueName("ITEM ", n);
+}
+
+/**
+    @param: the name of the operation, the number of operations, and the operation to time
+    @return: the time and allocations taken by calling run(i) for every i in [0, operations)
+*/
+template <class Operation>
+BenchResult measure(const std::string &name, long long operations, Operation run)
+{
+    unsigned long long allocations_before = allocationCount();
+    auto start = std::chrono::steady_clock::now();
+    for (long long i = 0; i < operations; i++)
+    {
+        run(i);
+    }
+    auto stop = std::chrono::steady_clock::now();
+    unsigned long long allocations = allocationCount() - allocations_before; // before copying the name
+    return {name, operations, double(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count()),
+            allocations};
+}
+
+std::vector<BenchResult> results; // every printed result, in order, for the JSON report
+
+/**
+    @post: prints the time and allocations of one operation and keeps the result for the JSON report
+*/
+void printResult(const BenchResult &result)
+{
+    results.push_back(result);
+    std::cout << std::left << std::setw(40) << result.name_
+              << std::right << std::setw(12) << std::fixed << std::setprecision(1) << result.nanoseconds_ / result.operations_ << " ns/op"
+              << std::setw(12) << std::setprecision(2) << double(result.allocations_) / result.operations_ << " allocs/op" << std::endl;
+}
+
+/**
+    @post: times addItem, findItem and removeItem on an inventory of consumables,
+           reporting the allocations made per call.
+*/
+void benchmarkInventoryAllocations(int size)
+{
+    Inventory inventory;
+    std::vector<Item *> items;
+    for (int i = 0; i < size; i++)
+    {
+        items.push_back(new Item(itemName(i), CONSUMABLE, 1, 1, 1));
+    }
+    inventory.addItems(items);
+
+    std::vector<Item *> duplicates;
+    for (int i = 0; i < size; i++)
+    {
+        duplicates.push_back(new Item(itemName(i), CONSUMABLE, 1, 1, 1));
+    }
+    std::vector<std::string> names;
+    for (int i = 0; i < size; i++)
+    {
+        names.push_back(itemName(i));
+    }
+
+    printResult(measure("Inventory::addItem (CONSUMABLE update)", size, [&](long long i)
+                        { inventory.addItem(duplicates[i]); }));
+    printResult(measure("Inventory::findItem", size, [&](long long i)
+                        { inventory.findItem(names[i]); }));
+    printResult(measure("Inventory::removeItem (CONSUMABLE)", size, [&](long long i)
+                        { inventory.removeItem(names[i]); }));
+}
+
+/**
+    @post: times constructing many Items that share a small set of names, and sorting them by name.
+*/
+void benchmarkItemNames(int size, int distinct_names)
+{
+    std::vector<std::string> names;
+    for (int i = 0; i < distinct_names; i++)
+    {
+        names.push_back("LONG ENCHANTED ITEM NAME " + itemName(i));
+    }
+    std::vector<Item> items;
+    items.reserve(size);
+    printResult(measure("Item construction (shared names)", size, [&](long long i)
+                        { items.emplace_back(names[i % distinct_names], WEAPON, 1, 1, 1); }));
+    printResult(measure("std::sort by Item::operator<", 1, [&](long long)
+                        { std::sort(items.begin(), items.end()); }));
+    std::cout << "distinct names stored: " << NameTable::size() << std::endl;
+}
+
+/**
+    @post: times findItem, and removeItem followed by addItem, on both Inventory backends for growing sizes,
+           to show where the flat sorted vector stops beating the BinarySearchTree.
+*/
+void benchmarkInventoryBackends()
+{
+    std::cout << std::endl
+              << "size: BST find / FLAT find, BST churn / FLAT churn (ns/op)" << std::endl;
+    for (int size = 16; size <= 65536; size *= 4)
+    {
+        std::vector<std::string> names;
+        for (int i = 0; i < size; i++)
+        {
+            names.push_back(itemName((i * 7919) % size)); // a fixed shuffle of the names
+        }
+        long long operations = 200000;
+        double results[2][2];
+        InventoryBackend backends[2] = {BST_BACKEND, FLAT_BACKEND};
+        for (int b = 0; b < 2; b++)
+        {
+            Inventory inventory(backends[b]);
+            std::vector<Item *> items;
+            for (int i = 0; i < size; i++)
+            {
+                items.push_back(new Item(names[i], WEAPON, 1, 1, 1));
+                inventory.addItem(items.back());
+            }
+            results[b][0] = measure("find", operations, [&](long long i)
+                                    { inventory.findItem(names[(i * 31) % size]); })
+                                .nanoseconds_ /
+                            operations;
+            results[b][1] = measure("churn", operations, [&](long long i)
+                                    { int k = (i * 31) % size;
+                                      inventory.removeItem(names[k]);
+                                      inventory.addItem(items[k]); })
+                                .nanoseconds_ /
+                            operations;
+        }
+        std::cout << std::setw(6) << size << ": " << std::fixed << std::setprecision(1)
+                  << results[0][0] << " / " << results[1][0] << ", "
+                  << results[0][1] << " / " << results[1][1] << std::endl;
+    }
+}
+
+/**
+    @post: times the positional workloads QuestList inherits from DoublyLinkedList: appending quests,
+           reading every position in order, reading random positions, swapping nodes near the front
+           (which cuts back the position index), and a full walk with iterators.
+*/
+void benchmarkQuestListPositions()
+{
+    std::cout << std::endl
+              << "size: append / scan getItem(i) / random getItem / swapNode+getItem / iterate (ns/op)" << std::endl;
+    for (int size = 256; size <= 65536; size *= 4)
+    {
+        std::vector<Quest *> quests;
+        for (int i = 0; i < size; i++)
+        {
+            quests.push_back(new Quest(itemName(i), "", false, i, {}, {}));
+        }
+        QuestList list;
+        long long sum = 0; // keeps the reads from being optimized away
+        double append = measure("append", size, [&](long long i)
+                                { list.insert(list.getLength(), quests[i]); })
+                            .nanoseconds_ /
+                        size;
+        double scan = measure("scan", size, [&](long long i)
+                              { sum += list.getItem(i)->experience_points_; })
+                          .nanoseconds_ /
+                      size;
+        long long operations = 100000;
+        double random = measure("random", operations, [&](long long i)
+                                { sum += list.getItem((i * 7919) % size)->experience_points_; })
+                            .nanoseconds_ /
+                        operations;
+        double swaps = measure("swap", 1000, [&](long long i)
+                               { list.DoublyLinkedList<Quest *>::swapNode(i % 16, size / 2);
+                                 sum += list.getItem((i * 7919) % size)->experience_points_; })
+                           .nanoseconds_ /
+                       1000;
+        double iterate = measure("iterate", 1, [&](long long)
+                                 { for (Quest *quest : list)
+                                   {
+                                       sum += quest->experience_points_;
+                                   } })
+                             .nanoseconds_ /
+                         size;
+        std::cout << std::setw(6) << size << ": " << std::fixed << std::setprecision(1)
+                  << append << " / " << scan << " / " << random << " / " << swaps << " / " << iterate
+                  << (sum == 0 ? " " : "") << std::endl;
+        list.clear();
+        for (Quest *quest : quests)
+        {
+            delete quest;
+        }
+    }
+}
+
+/**
+    @post: times calculateGainedExperience and questHistory("COMPLETE") over a list whose quests were created
+           while it was filled, then again after a quarter of the quests were removed and appended again.
+*/
+void benchmarkQuestListTraversal(int size)
+{
+    std::vector<Quest *> quests;
+    QuestList list;
+    for (int i = 0; i < size; i++)
+    {
+        // the quest and its strings are allocated between list nodes, as they are when a file is loaded
+        quests.push_back(new Quest("QUEST " + itemName(i), "A quest description long enough to live on the heap", i % 16 == 0, i, {}, {}));
+        list.insert(list.getLength(), quests.back());
+    }
+
+    std::ostringstream sink;
+    std::streambuf *console = std::cout.rdbuf(sink.rdbuf());
+    long long sum = 0;
+    for (int pass = 0; pass < 2; pass++)
+    {
+        BenchResult gained = measure("calculateGainedExperience", 100, [&](long long)
+                                     { sum += list.calculateGainedExperience(); });
+        BenchResult history = measure("questHistory(\"COMPLETE\")", 100, [&](long long)
+                                      { sink.str("");
+                                        list.questHistory("COMPLETE"); });
+        std::cout.rdbuf(console);
+        std::cout << (pass == 0 ? "fresh list:" : "after churn:") << std::endl;
+        gained.operations_ *= size; // report per quest visited
+        history.operations_ *= size;
+        printResult(gained);
+        printResult(history);
+        std::cout.rdbuf(sink.rdbuf());
+
+        // only the node layout matters here, so the churn skips QuestList's title index upkeep;
+        // the index is not used again before list.clear()
+        for (int i = 0; i < size / 4; i++)
+        {
+            size_t position = (size_t(i) * 7919) % list.getLength();
+            Quest *quest = list.getItem(position);
+            list.DoublyLinkedList<Quest *>::remove(position);
+            list.DoublyLinkedList<Quest *>::insert(list.getLength(), quest);
+        }
+    }
+    std::cout.rdbuf(console);
+    std::cout << (sum == 0 ? " " : "");
+    list.clear();
+    for (Quest *quest : quests)
+    {
+        delete quest;
+    }
+}
+
+/**
+    @post: times questQuery and questPlan on a ladder of diamond-shaped dependencies, where each level has two quests
+           that both depend on both quests of the level below, so the number of dependency paths doubles every level.
+*/
+void benchmarkQuestPlans()
+{
+    std::cout << std::endl
+              << "levels: questQuery / questPlan (ns per query, lines printed)" << std::endl;
+    std::ostringstream sink;
+    for (int levels = 4; levels <= 20; levels += 4)
+    {
+        QuestList list;
+        std::vector<Quest *> below;
+        for (int level = 0; level < levels; level++)
+        {
+            std::vector<Quest *> current;
+            for (int k = 0; k < 2; k++)
+            {
+                current.push_back(new Quest(itemName(level * 2 + k), "", false, 1, below, {}));
+                list.addQuest(current.back());
+            }
+            below = current;
+        }
+        std::string title = below[0]->title_;
+        list.getQuestGraph(); // compile the graph before timing
+        std::streambuf *console = std::cout.rdbuf(sink.rdbuf());
+        sink.str("");
+        BenchResult query = measure("questQuery", 1, [&](long long)
+                                    { list.questQuery(title); });
+        std::string output = sink.str();
+        size_t query_lines = std::count(output.begin(), output.end(), '\n');
+        sink.str("");
+        BenchResult plan = measure("questPlan", 1, [&](long long)
+                                   { list.questPlan(title); });
+        output = sink.str();
+        size_t plan_lines = std::count(output.begin(), output.end(), '\n');
+        std::cout.rdbuf(console);
+        std::cout << std::setw(6) << levels << ": " << std::fixed << std::setprecision(0)
+                  << query.nanoseconds_ << " (" << query_lines << ") / "
+                  << plan.nanoseconds_ << " (" << plan_lines << ")" << std::endl;
+        for (Quest *quest : list)
+        {
+            delete quest;
+        }
+    }
+}
+
+/**
+    @post: times listing the available quests of a long quest line, with a scan that calls questAvailable on every quest
+           (what questHistory("AVAILABLE") used to do) and with questHistory's available set, and times completing
+           quests one after another with setQuestComplete.
+*/
+void benchmarkQuestAvailability(int size)
+{
+    QuestList list;
+    std::vector<Quest *> quests;
+    for (int i = 0; i < size; i++)
+    {
+        std::vector<Quest *> dependencies;
+        if (i > 0)
+        {
+            dependencies.push_back(quests[i - 1]);
+            dependencies.push_back(quests[(i * 7919) % i]);
+        }
+        quests.push_back(new Quest(itemName(i), "", false, 1, dependencies, {}));
+        list.addQuest(quests.back());
+    }
+    list.getQuestGraph();
+
+    std::ostringstream sink;
+    std::streambuf *console = std::cout.rdbuf(sink.rdbuf());
+    int completions = size / 2;
+    BenchResult complete = measure("setQuestComplete", completions, [&](long long i)
+                                   { list.setQuestComplete(quests[i]->title_); });
+    BenchResult scan = measure("questAvailable scan", 100, [&](long long)
+                               { sink.str("");
+                                 for (Quest *quest : list)
+                                 {
+                                     if (list.questAvailable(quest))
+                                     {
+                                         list.printQuest(quest);
+                                     }
+                                 } });
+    BenchResult history = measure("questHistory(\"AVAILABLE\")", 100, [&](long long)
+                                  { sink.str("");
+                                    list.questHistory("AVAILABLE"); });
+    std::cout.rdbuf(console);
+    std::cout << std::endl;
+    printResult(complete);
+    printResult(scan);
+    printResult(history);
+    for (Quest *quest : quests)
+    {
+        delete quest;
+    }
+}
+
+/**
+    @param: a quest pointer
+    @return: the projected experience of the quest, summed recursively without any caching
+             (how QuestList::calculateProjectedExperience used to work), for comparison
+*/
+int uncachedProjectedExperience(Quest *quest)
+{
+    int projected_experience = quest->experience_points_;
+    for (Quest *subquest : quest->subquests_)
+    {
+        projected_experience += uncachedProjectedExperience(subquest);
+    }
+    return projected_experience;
+}
+
+/**
+    @param: a quest pointer
+    @return: the pathway experience of the quest, summed recursively without any caching
+*/
+int uncachedPathwayExperience(Quest *quest)
+{
+    int pathway_experience = quest->completed_ ? quest->experience_points_ : 0;
+    for (Quest *subquest : quest->subquests_)
+    {
+        pathway_experience += uncachedPathwayExperience(subquest);
+    }
+    return pathway_experience;
+}
+
+/**
+    @post: prints what QuestList::recursiveQuestQuery prints, with the recursive implementation it used to have
+*/
+void recursiveReferenceQuery(QuestList &list, Quest *quest)
+{
+    if (quest->dependencies_.size() == 0 || list.dependenciesComplete(quest))
+    {
+        std::cout << "Ready: " << quest->title_ << std::endl;
+        return;
+    }
+    for (Quest *dependency : quest->dependencies_)
+    {
+        if (!dependency->completed_)
+        {
+            recursiveReferenceQuery(list, dependency);
+        }
+    }
+    std::cout << "  " << quest->title_ << std::endl;
+}
+
+/**
+    @post: prints what QuestList::printQuestDetails prints, with the recursive implementation it used to have
+*/
+void recursiveReferenceDetails(Quest *main_quest)
+{
+    int pathway_total = uncachedPathwayExperience(main_quest);
+    int projected_total = uncachedProjectedExperience(main_quest);
+    int experience_percentage = 0;
+    if (projected_total > 0)
+    {
+        experience_percentage = floor(((double)pathway_total / projected_total) * 100);
+    }
+    std::cout << main_quest->title_ << " (" << experience_percentage << "% Complete)" << std::endl;
+    for (Quest *subquest : main_quest->subquests_)
+    {
+        std::cout << "  " << subquest->title_ << ": " << (subquest->completed_ ? "Complete" : "Not Complete") << std::endl;
+        recursiveReferenceDetails(subquest);
+    }
+}
+
+/**
+    @post: times the recursive and the iterative quest traversals on a chain where every quest depends on, and has as
+           its subquest, the one before it. The recursive versions only run on chains short enough for the call stack.
+           The quest graph is compiled before timing, as any earlier query on the list would have done; the iterative
+           walks mark quests by its ids. Both questQuery versions run once untimed first, so neither pays for growing
+           the output buffer or the walk's stack. printQuestDetails is timed cold, so its time includes caching the totals.
+*/
+void benchmarkQuestChains()
+{
+    std::cout << std::endl
+              << "depth: questQuery recursive / iterative, printQuestDetails recursive / iterative (ns per quest)" << std::endl;
+    std::ostringstream sink;
+    for (int depth = 1000; depth <= 1000000; depth *= 10)
+    {
+        QuestList list;
+        Quest *previous = nullptr;
+        for (int i = 0; i < depth; i++)
+        {
+            std::vector<Quest *> edges;
+            if (previous != nullptr)
+            {
+                edges.push_back(previous);
+            }
+            previous = new Quest(itemName(i), "", false, 1, edges, edges);
+            list.insert(list.getLength(), previous);
+        }
+        list.getQuestGraph();
+        bool recursive = depth <= 10000;
+        std::streambuf *console = std::cout.rdbuf(sink.rdbuf());
+        double timings[4] = {0, 0, 0, 0};
+        if (recursive)
+        {
+            recursiveReferenceQuery(list, previous);
+            sink.str("");
+            timings[0] = measure("", 1, [&](long long)
+                                 { recursiveReferenceQuery(list, previous); })
+                             .nanoseconds_;
+            sink.str("");
+            timings[2] = measure("", 1, [&](long long)
+                                 { recursiveReferenceDetails(previous); })
+                             .nanoseconds_;
+        }
+        list.recursiveQuestQuery(previous);
+        sink.str("");
+        timings[1] = measure("", 1, [&](long long)
+                             { list.recursiveQuestQuery(previous); })
+                         .nanoseconds_;
+        sink.str("");
+        timings[3] = measure("", 1, [&](long long)
+                             { list.printQuestDetails(previous); })
+                         .nanoseconds_;
+        std::cout.rdbuf(console);
+        std::cout << std::setw(8) << depth << ": " << std::fixed << std::setprecision(1);
+        for (int t = 0; t < 4; t++)
+        {
+            if (t % 2 == 0 && !recursive)
+            {
+                std::cout << "(too deep)";
+            }
+            else
+            {
+                std::cout << timings[t] / depth;
+            }
+            std::cout << (t == 3 ? "\n" : (t == 1 ? ", " : " / "));
+        }
+        for (Quest *quest : list)
+        {
+            delete quest;
+        }
+    }
+}
+
+/**
+    @post: times projected experience on a ladder where each quest has both quests of the level below as subquests:
+           uncached, the first cached call, a warm call, and a call after completing a quest at the bottom.
+*/
+void benchmarkQuestExperience(int levels)
+{
+    QuestList list;
+    std::vector<Quest *> below;
+    for (int level = 0; level < levels; level++)
+    {
+        std::vector<Quest *> current;
+        for (int k = 0; k < 2; k++)
+        {
+            current.push_back(new Quest(itemName(level * 2 + k), "", false, 1, {}, below));
+            list.addQuest(current.back());
+        }
+        below = current;
+    }
+    Quest *top = below[0];
+    list.getQuestGraph();
+    long long sum = 0;
+    std::cout << std::endl;
+    printResult(measure("projected XP, uncached recursion", 10, [&](long long)
+                        { sum += uncachedProjectedExperience(top); }));
+    printResult(measure("projected XP, first cached call", 1, [&](long long)
+                        { sum += list.calculateProjectedExperience(top); }));
+    printResult(measure("projected XP, warm", 100000, [&](long long)
+                        { sum += list.calculateProjectedExperience(top); }));
+    printResult(measure("setQuestComplete + pathway XP", 1000, [&](long long i)
+                        { list.setQuestComplete(itemName(i % 2), i % 4 < 2);
+                          sum += list.calculatePathwayExperience(top); }));
+    std::cout << (sum == 0 ? " " : "");
+    for (Quest *quest : list)
+    {
+        delete quest;
+    }
+}
+
+/**
+    @post: times computing projected and pathway experience for every quest of a wide, four-level subquest graph:
+           one uncached recursive call per quest (the leaderboard loop), and calculateAllExperience with 1 and more threads.
+*/
+void benchmarkAllExperience(int quests_per_level)
+{
+    QuestList list;
+    std::vector<Quest *> below;
+    for (int level = 0; level < 4; level++)
+    {
+        std::vector<Quest *> current;
+        for (int i = 0; i < quests_per_level; i++)
+        {
+            std::vector<Quest *> subquests;
+            for (int k = 0; k < 3 && !below.empty(); k++)
+            {
+                subquests.push_back(below[(size_t(i) * 7919 + k * 104729) % below.size()]);
+            }
+            current.push_back(new Quest(itemName(level * quests_per_level + i), "", i % 3 == 0, i % 100, {}, subquests));
+            list.insert(list.getLength(), current.back());
+        }
+        below = current;
+    }
+    list.getQuestGraph();
+    long long sum = 0;
+    std::cout << std::endl;
+    BenchResult serial = measure("per-quest recursion", 1, [&](long long)
+                                 { for (Quest *quest : list)
+                                   {
+                                       sum += uncachedProjectedExperience(quest) + uncachedPathwayExperience(quest);
+                                   } });
+    serial.operations_ = list.getLength();
+    printResult(serial);
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned threads = 1; threads <= cores; threads *= 2)
+    {
+        list.invalidateQuestGraph();
+        list.getQuestGraph();
+        BenchResult bulk = measure("calculateAllExperience, " + std::to_string(threads) + " threads", 1, [&](long long)
+                                   { sum += list.calculateAllExperience(threads)[0].projected_; });
+        bulk.operations_ = list.getLength();
+        printResult(bulk);
+    }
+    std::cout << (sum == 0 ? " " : "");
+    for (Quest *quest : list)
+    {
+        delete quest;
+    }
+}
+
+/**
+    @post: writes a quest csv file with the given number of quests, each depending on up to two earlier quests
+           and with up to two subquests, some of which are only ever mentioned (so they load as "NOT DISCOVERED");
+           then compares the heap memory and load time of QuestList and QuestStore for the file.
+*/
+void benchmarkQuestStore(int size)
+{
+    const std::string file_name = "benchmark_quests.csv";
+    {
+        std::ofstream fout(file_name);
+        DataGenerator generator;
+        generator.writeQuests(fout, size);
+    }
+
+    std::cout << std::endl;
+    long long bytes_before = liveBytes();
+    auto start = std::chrono::steady_clock::now();
+    QuestList *list = new QuestList(file_name);
+    double list_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    long long list_bytes = liveBytes() - bytes_before;
+    size_t quests = list->getLength();
+    std::cout << "QuestList:  " << quests << " quests, " << list_bytes / quests << " bytes/quest, "
+              << std::setprecision(2) << list_seconds << " s to load" << std::endl;
+    for (Quest *quest : *list)
+    {
+        delete quest;
+    }
+    delete list;
+
+    bytes_before = liveBytes();
+    start = std::chrono::steady_clock::now();
+    QuestStore *store = new QuestStore(file_name);
+    double store_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    long long store_bytes = liveBytes() - bytes_before;
+    std::cout << "QuestStore: " << store->getQuestCount() << " quests, " << store_bytes / quests << " bytes/quest, "
+              << std::setprecision(2) << store_seconds << " s to load" << std::endl;
+    delete store;
+    std::remove(file_name.c_str());
+}
+
+/**
+    @post: Sends everything written to std::cout to a string for as long as the object lives,
+           so benchmarks of the printing functions measure the formatting, not the terminal.
+           Results measured while it lives are printed after it is gone.
+*/
+class SilenceOutput
+{
+public:
+    SilenceOutput() : old_buffer_{std::cout.rdbuf(sink_.rdbuf())}
+    {
+    }
+    ~SilenceOutput()
+    {
+        std::cout.rdbuf(old_buffer_);
+    }
+    // empties the string, so long runs do not keep every line in memory
+    void drain()
+    {
+        sink_.str(std::string());
+    }
+
+private:
+    std::ostringstream sink_;
+    std::streambuf *old_buffer_;
+};
+
+/**
+    @post: times add, contains and remove (by value and by handle) on an ArrayBag at its full capacity of 100 entries,
+           then fills a bag with a capacity of 100000, whose storage grows as it fills, and removes by handle from it.
+*/
+void benchmarkArrayBag(int operations)
+{
+    std::cout << std::endl;
+    ArrayBag<int> bag;
+    printResult(measure("ArrayBag::add (fill to capacity)", operations, [&](long long i)
+                        { if (!bag.add(int(i % 100))) bag.clear(); }));
+    bag.clear();
+    for (int i = 0; bag.add(i); i++)
+    {
+    }
+    int found = 0;
+    printResult(measure("ArrayBag::contains (full bag)", operations, [&](long long i)
+                        { found += bag.contains(int((i * 37) % 200)); }));
+    printResult(measure("ArrayBag::remove + add (full bag)", operations, [&](long long i)
+                        { int entry = int((i * 37) % 100);
+                          bag.remove(entry);
+                          bag.add(entry); }));
+    BagHandle handles[100];
+    bag.clear();
+    for (int i = 0; i < 100; i++)
+    {
+        bag.add(i, handles[i]);
+    }
+    printResult(measure("ArrayBag::remove(handle) + add (full bag)", operations, [&](long long i)
+                        { int entry = int((i * 37) % 100);
+                          bag.remove(handles[entry]);
+                          bag.add(entry, handles[entry]); }));
+    long long sum = 0;
+    printResult(measure("ArrayBag::toVector (full bag)", operations / 10, [&](long long)
+                        { for (int entry : bag.toVector()) sum += entry; }));
+    printResult(measure("ArrayBag::view (full bag)", operations / 10, [&](long long)
+                        { for (int entry : bag.view()) sum += entry; }));
+    ArrayBag<int> half;
+    for (int i = 0; i < 50; i++)
+    {
+        half.add(i);
+    }
+    ArrayBag<int> merged;
+    printResult(measure("ArrayBag::operator+= (50 + 50 entries)", operations / 10, [&](long long)
+                        { merged = half;
+                          merged += half;
+                          sum += merged.getCurrentSize(); }));
+    const int LARGE = 100000;
+    std::vector<BagHandle> large_handles(LARGE);
+    ArrayBag<int> large(LARGE);
+    BenchResult fill = measure("ArrayBag::add (fill 100000, growing)", 1, [&](long long)
+                               { for (int i = 0; i < LARGE; i++)
+                                 {
+                                     large.add(i, large_handles[i]);
+                                 } });
+    fill.operations_ = LARGE; // one fill counts as one operation per entry
+    printResult(fill);
+    printResult(measure("ArrayBag::remove(handle) + add (100000 entries)", operations, [&](long long i)
+                        { int entry = int((i * 7919) % LARGE);
+                          large.remove(large_handles[entry]);
+                          large.add(entry, large_handles[entry]); }));
+    std::cout << "entries found: " << found << " (" << sum << ")" << std::endl;
+}
+
+/**
+    @post: deletes every character in the tavern and empties it.
+*/
+void emptyTavern(Tavern &tavern)
+{
+    for (Character *character : tavern.toVector())
+    {
+        tavern.exitTavern(character);
+        delete character;
+    }
+}
+
+/**
+    @post: writes a full tavern csv file (100 characters, the capacity of a Tavern), then times loading it,
+           tavernReport, createCombatQueue with every filter, and filtered scans through toVector and characters().
+*/
+void benchmarkTavern(int operations)
+{
+    const std::string file_name = "benchmark_tavern.csv";
+    {
+        std::ofstream fout(file_name);
+        DataGenerator generator;
+        generator.writeTavern(fout, 100);
+    }
+    std::cout << std::endl;
+    printResult(measure("Tavern csv load (100 characters)", operations / 100, [&](long long)
+                        { Tavern tavern(file_name);
+                          emptyTavern(tavern); }));
+
+    Tavern tavern(file_name);
+    BenchResult report;
+    {
+        SilenceOutput silence;
+        report = measure("Tavern::tavernReport", operations, [&](long long)
+                         { tavern.tavernReport();
+                           silence.drain(); });
+    }
+    printResult(report);
+    const std::string filters[5] = {"NONE", "LVLASC", "LVLDES", "HPASC", "HPDES"};
+    for (const std::string &filter : filters)
+    {
+        printResult(measure("Tavern::createCombatQueue " + filter, operations, [&](long long)
+                            { tavern.createCombatQueue(filter); }));
+    }
+    int matching = 0;
+    printResult(measure("Tavern::toVector + filter (ELF enemies, level 5-15)", operations, [&](long long)
+                        { for (Character *character : tavern.toVector())
+                              matching += character->getRace() == "ELF" && character->isEnemy() &&
+                                          character->getLevel() >= 5 && character->getLevel() <= 15; }));
+    printResult(measure("Tavern::characters (ELF enemies, level 5-15)", operations, [&](long long)
+                        { matching += tavern.characters().race(ELF).enemies().levels(5, 15).count(); }));
+    printResult(measure("Tavern::characters().subclass(MAGE) walk", operations, [&](long long)
+                        { for (Character *mage : tavern.characters().subclass(MAGE))
+                              matching += mage->getLevel(); }));
+    std::cout << "characters matched: " << matching << std::endl;
+    emptyTavern(tavern);
+    std::remove(file_name.c_str());
+}
+
+/**
+    @post: times the writer of a ConcurrentTavern (exit and enter, publishing a snapshot every 100 of them, as at the end
+           of a tick) alone and while readers take snapshots and format reports on other threads, publishing alone,
+           and the readers' side of the same.
+*/
+void benchmarkConcurrentTavern(int operations)
+{
+    ConcurrentTavern tavern;
+    DataGenerator generator;
+    std::vector<Character *> characters;
+    for (int i = 0; i < 100; i++)
+    {
+        characters.push_back(generator.makeCharacter(i));
+        tavern.enterTavern(characters.back());
+    }
+    tavern.publish();
+    std::cout << std::endl;
+    // a tick of 100 exits and entries, then one snapshot
+    auto churn = [&](long long i)
+    {
+        tavern.exitTavern(characters[i % 100]);
+        tavern.enterTavern(characters[i % 100]);
+        if (i % 100 == 99)
+        {
+            tavern.publish();
+        }
+    };
+    printResult(measure("ConcurrentTavern exit + enter", operations, churn));
+    printResult(measure("ConcurrentTavern publish (100 characters)", operations / 100, [&](long long)
+                        { tavern.publish(); }));
+
+    std::atomic<bool> stop{false};
+    std::atomic<long long> reads{0};
+    unsigned reader_count = std::max(1u, std::thread::hardware_concurrency() - 1);
+    std::vector<std::thread> readers;
+    for (unsigned r = 0; r < reader_count; r++)
+    {
+        readers.emplace_back([&]
+                             {
+                                 std::ostringstream report;
+                                 while (!stop.load(std::memory_order_relaxed))
+                                 {
+                                     tavern.getSnapshot()->tavernReport(report);
+                                     report.str(std::string());
+                                     reads.fetch_add(1, std::memory_order_relaxed);
+                                 } });
+    }
+    BenchResult writer = measure("ConcurrentTavern exit + enter (readers running)", operations, churn);
+    stop.store(true);
+    for (std::thread &reader : readers)
+    {
+        reader.join();
+    }
+    printResult(writer);
+    std::cout << "snapshot reports read meanwhile: " << reads.load() << std::endl;
+    printResult(measure("ConcurrentTavern snapshot tavernReport", operations, [&](long long)
+                        { std::ostringstream report;
+                          tavern.getSnapshot()->tavernReport(report); }));
+    for (Character *character : characters)
+    {
+        delete character;
+    }
+}
+
+/**
+    @post: fills a World with full taverns, then times serving tainted stew, preparing combat and counting the
+           statistics of every tavern, with one worker and with one per hardware thread.
+*/
+void benchmarkWorld(int taverns)
+{
+    const std::string file_name = "benchmark_tavern.csv";
+    {
+        std::ofstream fout(file_name);
+        DataGenerator generator;
+        generator.writeTavern(fout, 100);
+    }
+    std::cout << std::endl;
+    auto perTavern = [&](BenchResult result)
+    {
+        result.operations_ = taverns; // one pass over the world counts as one operation per tavern
+        return result;
+    };
+    std::vector<unsigned> worker_counts = {1};
+    if (std::thread::hardware_concurrency() > 1)
+    {
+        worker_counts.push_back(std::thread::hardware_concurrency());
+    }
+    for (unsigned workers : worker_counts)
+    {
+        World world(workers);
+        for (int i = 0; i < taverns; i++)
+        {
+            world.addTavern(file_name);
+        }
+        std::string suffix = " (" + std::to_string(workers) + " workers, per tavern)";
+        printResult(perTavern(measure("World::serveTaintedStew" + suffix, 1, [&](long long)
+                                      { world.serveTaintedStew(); })));
+        printResult(perTavern(measure("World::prepareCombat LVLASC" + suffix, 1, [&](long long)
+                                      { world.prepareCombat("LVLASC"); })));
+        long long characters = 0;
+        printResult(perTavern(measure("World::getStatistics" + suffix, 1, [&](long long)
+                                      { characters += world.getStatistics().characters_; })));
+        std::cout << "characters counted: " << characters << std::endl;
+    }
+    std::remove(file_name.c_str());
+}
+
+/**
+    @post: writes an item csv file, then times loading it, addItem, findItem and removeItem on random items,
+           and each way of printing the inventory.
+*/
+void benchmarkInventoryOperations(int size)
+{
+    const std::string file_name = "benchmark_items.csv";
+    {
+        std::ofstream fout(file_name);
+        DataGenerator generator;
+        generator.writeItems(fout, size);
+    }
+    std::cout << std::endl;
+    printResult(measure("Inventory csv load", 1, [&](long long)
+                        { Inventory inventory(file_name); }));
+
+    DataGenerator generator(7);
+    std::vector<Item *> items;
+    std::vector<std::string> names;
+    for (int i = 0; i < size; i++)
+    {
+        items.push_back(generator.makeItem(i));
+        names.push_back(items.back()->getName());
+    }
+    std::vector<int> order(size);
+    for (int i = 0; i < size; i++)
+    {
+        order[i] = i;
+    }
+    for (int i = size - 1; i > 0; i--)
+    {
+        std::swap(order[i], order[generator.nextInt(0, i)]);
+    }
+    Inventory inventory;
+    printResult(measure("Inventory::addItem (random items)", size, [&](long long i)
+                        { inventory.addItem(items[order[i]]); }));
+    printResult(measure("Inventory::findItem (random items)", size, [&](long long i)
+                        { inventory.findItem(names[order[(i * 7) % size]]); }));
+    std::vector<BenchResult> prints;
+    {
+        SilenceOutput silence;
+        prints.push_back(measure("Inventory::printInventoryInOrder", 1, [&](long long)
+                                 { inventory.printInventoryInOrder(); }));
+        const std::string attributes[5] = {"NAME", "TYPE", "LEVEL", "VALUE", "TIME"};
+        for (const std::string &attribute : attributes)
+        {
+            silence.drain();
+            prints.push_back(measure("Inventory::printInventory " + attribute, 1, [&](long long)
+                                     { inventory.printInventory(true, attribute); }));
+        }
+    }
+    for (const BenchResult &result : prints)
+    {
+        printResult(result);
+    }
+    printResult(measure("Inventory::removeItem (random items)", size, [&](long long i)
+                        { inventory.removeItem(names[order[i]]); }));
+    for (Item *item : items)
+    {
+        delete item;
+    }
+    std::remove(file_name.c_str());
+}
+
+/**
+    @post: times adding the same items to a BinarySearchTree in sorted, reverse sorted and random order.
+           The tree does not rebalance, so sorted input builds a list and each add walks all of it.
+*/
+void benchmarkItemTree(int size)
+{
+    DataGenerator generator;
+    std::vector<Item *> items;
+    for (int i = 0; i < size; i++)
+    {
+        items.push_back(generator.makeItem(i));
+    }
+    std::vector<Item *> sorted = items;
+    std::sort(sorted.begin(), sorted.end(), [](Item *a, Item *b)
+              { return *a < *b; });
+    std::vector<Item *> reversed(sorted.rbegin(), sorted.rend());
+
+    std::cout << std::endl;
+    const char *names[3] = {"BinarySearchTree::add (sorted)", "BinarySearchTree::add (reverse sorted)",
+                            "BinarySearchTree::add (random)"};
+    std::vector<Item *> *orders[3] = {&sorted, &reversed, &items};
+    for (int o = 0; o < 3; o++)
+    {
+        BinarySearchTree<Item *> tree;
+        printResult(measure(names[o], size, [&](long long i)
+                            { tree.add((*orders[o])[i]); }));
+        std::cout << "height: " << tree.getHeight() << std::endl;
+    }
+    for (Item *item : items)
+    {
+        delete item;
+    }
+}
+
+/**
+    @post: writes a quest csv file, then times loading it into a QuestList, and questQuery, questPlan
+           and calculateProjectedExperience on random quests.
+*/
+void benchmarkQuestListQueries(int size, int queries)
+{
+    const std::string file_name = "benchmark_quests.csv";
+    {
+        std::ofstream fout(file_name);
+        DataGenerator generator;
+        generator.writeQuests(fout, size);
+    }
+    std::cout << std::endl;
+    QuestList *list = nullptr;
+    printResult(measure("QuestList csv load", 1, [&](long long)
+                        { list = new QuestList(file_name); }));
+
+    DataGenerator generator(11);
+    std::vector<std::string> titles;
+    for (int i = 0; i < queries; i++)
+    {
+        titles.push_back(DataGenerator::uniqueName("QUEST ", generator.nextInt(0, size - 1)));
+    }
+    BenchResult query, plan;
+    {
+        SilenceOutput silence;
+        query = measure("QuestList::questQuery", queries, [&](long long i)
+                        { list->questQuery(titles[i]);
+                          silence.drain(); });
+        plan = measure("QuestList::questPlan", queries, [&](long long i)
+                       { list->questPlan(titles[i]);
+                         silence.drain(); });
+    }
+    printResult(query);
+    printResult(plan);
+    long long sum = 0;
+    printResult(measure("QuestList::calculateProjectedExperience", queries, [&](long long i)
+                        { sum += list->calculateProjectedExperience(list->getItem(int((i * 7919) % size))); }));
+    std::cout << "experience sum: " << sum << std::endl;
+    for (Quest *quest : *list)
+    {
+        delete quest;
+    }
+    delete list;
+    std::remove(file_name.c_str());
+}
+
+/**
+    @param: the name of an output file
+    @post: writes every recorded result to the file as a JSON array of objects with the fields
+           name, operations, ns_per_op and allocs_per_op.
+*/
+void writeJson(const std::string &output_file_name)
+{
+    std::ofstream fout(output_file_name);
+    if (fout.fail())
+    {
+        std::cerr << "File cannot be opened for writing." << std::endl;
+        exit(1);
+    }
+    fout << "[\n";
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const BenchResult &result = results[i];
+        fout << "  {\"name\": \"" << result.name_ << "\", \"operations\": " << result.operations_
+             << ", \"ns_per_op\": " << std::fixed << std::setprecision(1) << result.nanoseconds_ / result.operations_
+             << ", \"allocs_per_op\": " << std::setprecision(2) << double(result.allocations_) / result.operations_
+             << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    fout << "]\n";
+}
+
+int main(int argc, char *argv[])
+{
+#ifdef RPG_TRACK_ALLOCATIONS
+    // lookups and accessors that should never touch the heap
+    AllocationTracker::setBudget("Inventory::findItem", 0);
+    AllocationTracker::setBudget("Character::getRace", 0);
+    AllocationTracker::setBudget("Item::getType", 0);
+#endif
+    std::string output_file_name = argc > 1 ? argv[1] : "";
+    std::string group = argc > 2 ? argv[2] : "";
+    auto selected = [&](const std::string &name)
+    { return group.empty() || group == name; };
+
+    if (selected("bag"))
+    {
+        benchmarkArrayBag(1000000);
+    }
+    if (selected("tavern"))
+    {
+        benchmarkTavern(10000);
+        benchmarkConcurrentTavern(10000);
+    }
+    if (selected("world"))
+    {
+        benchmarkWorld(2000);
+    }
+    if (selected("inventory"))
+    {
+        benchmarkInventoryOperations(20000);
+        benchmarkItemTree(2000);
+        benchmarkInventoryAllocations(10000);
+        benchmarkItemNames(1000000, 1000);
+        benchmarkInventoryBackends();
+    }
+    if (selected("quests"))
+    {
+        benchmarkQuestListQueries(20000, 1000);
+        benchmarkQuestListPositions();
+        benchmarkQuestListTraversal(100000);
+        benchmarkQuestPlans();
+        benchmarkQuestAvailability(100000);
+        benchmarkQuestExperience(24);
+        benchmarkQuestChains();
+        benchmarkAllExperience(250000);
+        benchmarkQuestStore(1000000);
+    }
+    if (!output_file_name.empty())
+    {
+        writeJson(output_file_name);
+    }
+#ifdef RPG_INSTRUMENTATION
+    std::cout << std::endl;
+    Instrumentation::report(std::cout);
+#endif
+#ifdef RPG_TRACK_ALLOCATIONS
+    std::cout << std::endl;
+    AllocationTracker::report(std::cout);
+    if (!AllocationTracker::checkBudgets(std::cerr))
+    {
+        return 1;
+    }
+#endif
+    return 0;
+}
@@ -5,13 +5,13 @@
 
 template <class T>
 BinaryNode<T>::BinaryNode()
-    : item(nullptr), leftChildPtr(nullptr), rightChildPtr(nullptr)
+    : item(nullptr), leftChildPtr(nullptr), rightChildPtr(nullptr), subtreeSize(1)
 {
 } // end default constructor
 
 template <class T>
 BinaryNode<T>::BinaryNode(const T &anItem)
-    : item(anItem), leftChildPtr(nullptr), rightChildPtr(nullptr)
+    : item(anItem), leftChildPtr(nullptr), rightChildPtr(nullptr), subtreeSize(1)
 {
 } // end constructor
 
@@ -19,8 +19,10 @@ template <class T>
 BinaryNode<T>::BinaryNode(const T &anItem,
                           std::shared_ptr<BinaryNode<T>> leftPtr,
                           std::shared_ptr<BinaryNode<T>> rightPtr)
-    : item(anItem), leftChildPtr(leftPtr), rightChildPtr(rightPtr)
+    : item(anItem), leftChildPtr(leftPtr), rightChildPtr(rightPtr), subtreeSize(1)
 {
+   subtreeSize += (leftPtr == nullptr) ? 0 : leftPtr->getSubtreeSize();
+   subtreeSize += (rightPtr == nullptr) ? 0 : rightPtr->getSubtreeSize();
 } // end constructor
 
 template <class T>
@@ -41,6 +43,18 @@ bool BinaryNode<T>::isLeaf() const
    return ((leftChildPtr == nullptr) && (rightChildPtr == nullptr));
 }
 
+template <class T>
+int BinaryNode<T>::getSubtreeSize() const
+{
+   return subtreeSize;
+} // end getSubtreeSize
+
+template <class T>
+void BinaryNode<T>::setSubtreeSize(int size)
+{
+   subtreeSize = size;
+} // end setSubtreeSize
+
 template <class T>
 void BinaryNode<T>::setLeftChildPtr(std::shared_ptr<BinaryNode<T>> leftPtr)
 {
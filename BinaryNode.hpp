@@ -12,6 +12,7 @@ private:
    T item;                                       // Data portion
    std::shared_ptr<BinaryNode<T>> leftChildPtr;  // Pointer to left child
    std::shared_ptr<BinaryNode<T>> rightChildPtr; // Pointer to right child
+   int subtreeSize;                              // Number of nodes in the subtree rooted here
 
 public:
    BinaryNode();
@@ -23,6 +24,9 @@ public:
 
    bool isLeaf() const;
 
+   int getSubtreeSize() const;
+   void setSubtreeSize(int size);
+
    std::shared_ptr<BinaryNode<T>> getLeftChildPtr() const;
    std::shared_ptr<BinaryNode<T>> getRightChildPtr() const;
 
@@ -21,6 +21,7 @@ auto BinarySearchTree<T>::placeNode(std::shared_ptr<BinaryNode<T>> subTreePtr,
       else
          subTreePtr->setRightChildPtr(placeNode(subTreePtr->getRightChildPtr(), newNodePtr));
 
+      updateSubtreeSize(subTreePtr);
       return subTreePtr;
    } // end if
 } // end placeNode
@@ -55,6 +56,7 @@ std::shared_ptr<BinaryNode<T>> BinarySearchTree<T>::removeValue(std::shared_ptr<
          // Search the right subtree
          subTreePtr->setRightChildPtr(removeValue(subTreePtr->getRightChildPtr(), target, success));
       }
+      updateSubtreeSize(subTreePtr);
       return subTreePtr;
    } // end if
 } // end removeValue
@@ -87,6 +89,7 @@ auto BinarySearchTree<T>::removeNode(std::shared_ptr<BinaryNode<T>> nodePtr)
       T newNodeValue;
       nodePtr->setRightChildPtr(removeLeftmostNode(nodePtr->getRightChildPtr(), newNodeValue));
       nodePtr->setItem(newNodeValue);
+      updateSubtreeSize(nodePtr);
       return nodePtr;
    } // end if
 } // end removeNode
@@ -103,6 +106,7 @@ auto BinarySearchTree<T>::removeLeftmostNode(std::shared_ptr<BinaryNode<T>> node
    else
    {
       nodePtr->setLeftChildPtr(removeLeftmostNode(nodePtr->getLeftChildPtr(), inorderSuccessor));
+      updateSubtreeSize(nodePtr);
       return nodePtr;
    } // end if
 } // end removeLeftmostNode
@@ -142,6 +146,125 @@ void BinarySearchTree<T>::destroyTree(std::shared_ptr<BinaryNode<T>> subTreePtr)
    }                      // end if
 } // end destroyTree
 
+template <class T>
+int BinarySearchTree<T>::getHeightHelper(std::shared_ptr<BinaryNode<T>> subTreePtr)
+{
+   if (subTreePtr == nullptr)
+      return 0;
+   return 1 + std::max(getHeightHelper(subTreePtr->getLeftChildPtr()),
+                       getHeightHelper(subTreePtr->getRightChildPtr()));
+} // end getHeightHelper
+
+template <class T>
+int BinarySearchTree<T>::subtreeSizeOf(std::shared_ptr<BinaryNode<T>> subTreePtr)
+{
+   return (subTreePtr == nullptr) ? 0 : subTreePtr->getSubtreeSize();
+} // end subtreeSizeOf
+
+template <class T>
+void BinarySearchTree<T>::updateSubtreeSize(std::shared_ptr<BinaryNode<T>> subTreePtr)
+{
+   if (subTreePtr != nullptr)
+   {
+      subTreePtr->setSubtreeSize(1 + subtreeSizeOf(subTreePtr->getLeftChildPtr()) +
+                                 subtreeSizeOf(subTreePtr->getRightChildPtr()));
+   } // end if
+} // end updateSubtreeSize
+
+template <class T>
+int BinarySearchTree<T>::countBelow(const T &target, bool inclusive) const
+{
+   int count = 0;
+   auto curPtr = rootPtr;
+   while (curPtr != nullptr)
+   {
+      if (*curPtr->getItem() > *target)
+      {
+         curPtr = curPtr->getLeftChildPtr();
+      }
+      else if (*curPtr->getItem() == *target)
+      {
+         // Everything in the left subtree is smaller
+         count += subtreeSizeOf(curPtr->getLeftChildPtr());
+         if (inclusive)
+            count++;
+         return count;
+      }
+      else
+      {
+         // This node and its whole left subtree are smaller
+         count += subtreeSizeOf(curPtr->getLeftChildPtr()) + 1;
+         curPtr = curPtr->getRightChildPtr();
+      } // end if
+   }    // end while
+   return count;
+} // end countBelow
+
+template <class T>
+void BinarySearchTree<T>::rangeHelper(std::shared_ptr<BinaryNode<T>> subTreePtr,
+                                      const T &low, const T &high, std::vector<T> &result) const
+{
+   if (subTreePtr == nullptr)
+      return;
+
+   bool aboveLow = !(*low > *subTreePtr->getItem());   // item >= low
+   bool belowHigh = !(*subTreePtr->getItem() > *high); // item <= high
+
+   if (aboveLow)
+      rangeHelper(subTreePtr->getLeftChildPtr(), low, high, result);
+   if (aboveLow && belowHigh)
+      result.push_back(subTreePtr->getItem());
+   if (belowHigh)
+      rangeHelper(subTreePtr->getRightChildPtr(), low, high, result);
+} // end rangeHelper
+
+template <class T>
+void BinarySearchTree<T>::selectRangeHelper(std::shared_ptr<BinaryNode<T>> subTreePtr,
+                                            int first, int count, std::vector<T> &result) const
+{
+   if (subTreePtr == nullptr || count <= 0 || first >= subTreePtr->getSubtreeSize())
+      return;
+
+   int leftSize = subtreeSizeOf(subTreePtr->getLeftChildPtr());
+   if (first < leftSize)
+   {
+      selectRangeHelper(subTreePtr->getLeftChildPtr(), first, count, result);
+   }
+   // Ranks already covered by the left subtree (first..leftSize-1)
+   int taken = (first < leftSize) ? leftSize - first : 0;
+   if (taken < count && first <= leftSize)
+   {
+      result.push_back(subTreePtr->getItem());
+      taken++;
+   }
+   if (taken < count)
+   {
+      int rightFirst = (first > leftSize) ? first - leftSize - 1 : 0;
+      selectRangeHelper(subTreePtr->getRightChildPtr(), rightFirst, count - taken, result);
+   }
+} // end selectRangeHelper
+
+template <class T>
+std::shared_ptr<BinaryNode<T>> BinarySearchTree<T>::buildBalanced(const std::vector<T> &sortedItems,
+                                                                  int first, int last)
+{
+   if (first >= last)
+      return nullptr;
+
+   int mid = first + (last - first) / 2;
+   auto leftPtr = buildBalanced(sortedItems, first, mid);
+   auto rightPtr = buildBalanced(sortedItems, mid + 1, last);
+   // The three-argument constructor also sets the subtree size
+   return std::make_shared<BinaryNode<T>>(sortedItems[mid], leftPtr, rightPtr);
+} // end buildBalanced
+
+template <class T>
+void BinarySearchTree<T>::buildFromSorted(const std::vector<T> &sortedItems)
+{
+   clear();
+   rootPtr = buildBalanced(sortedItems, 0, static_cast<int>(sortedItems.size()));
+} // end buildFromSorted
+
 //////////////////////////////////////////////////////////////
 //      PUBLIC METHODS BEGIN HERE
 //////////////////////////////////////////////////////////////
@@ -193,13 +316,13 @@ bool BinarySearchTree<T>::isEmpty() const
 template <class T>
 int BinarySearchTree<T>::getHeight() const
 {
-   return this->getHeightHelper(rootPtr); // Call inherited method
+   return getHeightHelper(rootPtr);
 } // end getHeight
 
 template <class T>
 int BinarySearchTree<T>::getNumberOfNodes() const
 {
-   return this->getNumberOfNodesHelper(rootPtr); // Call inherited method
+   return subtreeSizeOf(rootPtr);
 } // end getNumberOfNodes
 
 template <class T>
@@ -241,6 +364,65 @@ std::shared_ptr<BinaryNode<T>> BinarySearchTree<T>::getPointerTo(const T &target
    return findNode(rootPtr, target);
 }
 
+//////////////////////////////////////////////////////////////
+//      Order-Statistic Section
+//////////////////////////////////////////////////////////////
+
+template <class T>
+int BinarySearchTree<T>::getRank(const T &target) const
+{
+   return countBelow(target, false);
+} // end getRank
+
+template <class T>
+T BinarySearchTree<T>::select(int k) const
+{
+   auto curPtr = rootPtr;
+   while (curPtr != nullptr && k >= 0 && k < curPtr->getSubtreeSize())
+   {
+      int leftSize = subtreeSizeOf(curPtr->getLeftChildPtr());
+      if (k < leftSize)
+      {
+         curPtr = curPtr->getLeftChildPtr();
+      }
+      else if (k == leftSize)
+      {
+         return curPtr->getItem();
+      }
+      else
+      {
+         k -= leftSize + 1;
+         curPtr = curPtr->getRightChildPtr();
+      } // end if
+   }    // end while
+   return T();
+} // end select
+
+template <class T>
+int BinarySearchTree<T>::countRange(const T &low, const T &high) const
+{
+   if (*low > *high)
+      return 0;
+   return countBelow(high, true) - countBelow(low, false);
+} // end countRange
+
+template <class T>
+void BinarySearchTree<T>::rangeSearch(const T &low, const T &high, std::vector<T> &result) const
+{
+   rangeHelper(rootPtr, low, high, result);
+} // end rangeSearch
+
+template <class T>
+void BinarySearchTree<T>::selectRange(int first, int count, std::vector<T> &result) const
+{
+   if (first < 0)
+   {
+      count += first;
+      first = 0;
+   }
+   selectRangeHelper(rootPtr, first, count, result);
+} // end selectRange
+
 //////////////////////////////////////////////////////////////
 //      Public Traversals Section
 //////////////////////////////////////////////////////////////
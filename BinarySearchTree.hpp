@@ -5,6 +5,7 @@
 #define BINARY_SEARCH_TREE_
 
 #include <memory>
+#include <vector>
 #include "BinaryNode.hpp"
 
 template <class T>
@@ -48,6 +49,40 @@ protected:
    // Recursively deletes all nodes from the tree.
    void destroyTree(std::shared_ptr<BinaryNode<T>> subTreePtr);
 
+   // Returns the number of nodes on the longest path down from the
+   // given node, 0 for nullptr.
+   static int getHeightHelper(std::shared_ptr<BinaryNode<T>> subTreePtr);
+
+   // Returns the number of nodes in the given subtree, 0 for nullptr.
+   static int subtreeSizeOf(std::shared_ptr<BinaryNode<T>> subTreePtr);
+
+   // Recomputes the subtree size of the given node from its children.
+   static void updateSubtreeSize(std::shared_ptr<BinaryNode<T>> subTreePtr);
+
+   // Returns the number of entries less than (or, if inclusive, equal to)
+   // the given target.
+   int countBelow(const T &target, bool inclusive) const;
+
+   // Appends, in order, every entry of the subtree within [low, high].
+   // Subtrees entirely outside the range are never visited.
+   void rangeHelper(std::shared_ptr<BinaryNode<T>> subTreePtr,
+                    const T &low, const T &high, std::vector<T> &result) const;
+
+   // Appends, in order, the entries of the subtree whose ranks fall in
+   // [first, first + count), where ranks are relative to the subtree.
+   void selectRangeHelper(std::shared_ptr<BinaryNode<T>> subTreePtr,
+                          int first, int count, std::vector<T> &result) const;
+
+   // Recursively builds a perfectly balanced subtree from the sorted
+   // entries in [first, last).
+   std::shared_ptr<BinaryNode<T>> buildBalanced(const std::vector<T> &sortedItems,
+                                                int first, int last);
+
+   // Replaces the contents of the tree with a perfectly balanced tree
+   // holding the given entries, which must already be in ascending order.
+   // Runs in O(n).
+   void buildFromSorted(const std::vector<T> &sortedItems);
+
 public:
    //------------------------------------------------------------
    // Constructor and Destructor Section.
@@ -72,6 +107,27 @@ public:
 
    std::shared_ptr<BinaryNode<T>> getPointerTo(const T &target) const;
 
+   //------------------------------------------------------------
+   // Order-Statistic Section.
+   // Every node records the size of its subtree, so these run in
+   // O(height) plus the number of entries reported.
+   //------------------------------------------------------------
+   // Returns the number of entries strictly less than target.
+   int getRank(const T &target) const;
+
+   // Returns the entry of rank k (0-based, ascending order), or a
+   // default-constructed T if k is out of range.
+   T select(int k) const;
+
+   // Returns the number of entries e with low <= e <= high.
+   int countRange(const T &low, const T &high) const;
+
+   // Appends, in ascending order, every entry e with low <= e <= high.
+   void rangeSearch(const T &low, const T &high, std::vector<T> &result) const;
+
+   // Appends, in ascending order, up to count entries starting at rank first.
+   void selectRange(int first, int count, std::vector<T> &result) const;
+
    //------------------------------------------------------------
    // Public Traversals Section.
    //------------------------------------------------------------
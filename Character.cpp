@@ -112,6 +112,7 @@ void Character::setRace(const std::string &race)
 */
 std::string Character::getRace() const
 {
+    RPG_ALLOCATION_SCOPE("Character::getRace");
     if (race_ == Race::HUMAN)
     {
         return "HUMAN";
@@ -138,6 +139,14 @@ std::string Character::getRace() const
     }
 }
 
+/**
+    @return : the race of the Character (the enum value)
+*/
+Race Character::getRaceType() const
+{
+    return race_;
+}
+
 /**
     @param  : an integer vitality
     @pre    : vitality >= 0 : Characters cannot have negative health
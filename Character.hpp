@@ -17,6 +17,8 @@
 #include <queue>
 #include <stack>
 #include <algorithm>
+#include <random>
+#include "AllocationTracker.hpp"
 
 enum Race
 {
@@ -28,6 +30,15 @@ enum Race
     UNDEAD
 };
 
+enum Subclass // the derived class of a Character
+{
+    NO_SUBCLASS,
+    BARBARIAN,
+    MAGE,
+    SCOUNDREL,
+    RANGER
+};
+
 enum Action // names of actions
 {
     BUFF_Heal,
@@ -68,6 +79,12 @@ public:
     */
     Character(const std::string &name, const std::string &race, int vitality = 0, int armor = 0, int level = 0, bool enemy = false);
 
+    /**
+        Destructor.
+        Virtual, so deleting a subclass through a Character pointer destroys the whole object.
+    */
+    virtual ~Character() = default;
+
     /**
         @param  : the name of the Character
         @post   : sets the Character's title to the value of the parameter, in UPPERCASE. Only alphabetical characters are allowed.
@@ -91,6 +108,11 @@ public:
     */
     std::string getRace() const;
 
+    /**
+        @return : the race of the Character (the enum value), for comparisons that should not build a string
+    */
+    Race getRaceType() const;
+
     /**
         @param  : an integer vitality
         @pre    : vitality >= 0 : Characters cannot have negative health
@@ -170,9 +192,15 @@ public:
     virtual void display() const = 0;
 
     /**
+    @param: the random number generator any chance is drawn from, owned by the caller (e.g. the character's Tavern)
     @post: Modifies the character's private member variables (the exact modifications will be subclass specific)
     */
-    virtual void eatTaintedStew() = 0;
+    virtual void eatTaintedStew(std::mt19937 &random) = 0;
+
+    /**
+    @return: the subclass of the character (the enum value), so it can be told apart without a cast
+    */
+    virtual Subclass getSubclass() const = 0;
 
     /**
     @pre: This function is called to execute the Action BUFF_Heal
@@ -0,0 +1,181 @@
+/*
+ * File Title: ConcurrentTavern.cpp
+ * Author: Mahim Ali
+ * Date: October 19, 2026
+ * This file implements a class called ConcurrentTavern
+ */
+#include "ConcurrentTavern.hpp"
+#include <cmath>
+#include <iomanip>
+
+/*
+    @return: the number of characters in the snapshot
+*/
+int TavernSnapshot::getCharacterCount() const
+{
+    return characters_.size();
+}
+
+/*
+    @return: the average level rounded to the nearest integer
+*/
+int TavernSnapshot::calculateAvgLevel() const
+{
+    return (level_sum_ > 0) ? round(double(level_sum_) / characters_.size()) : 0.0;
+}
+
+/*
+    @return: the percentage of enemies rounded up to 2 decimal places
+*/
+double TavernSnapshot::calculateEnemyPercentage() const
+{
+    double enemy_percent = (num_enemies_ > 0) ? (double(num_enemies_) / characters_.size()) * 100 : 0.0;
+    return std::ceil(enemy_percent * 100.0) / 100.0;
+}
+
+/*
+    @param: a race
+    @return: the number of characters of the race
+*/
+int TavernSnapshot::tallyRace(Race race) const
+{
+    return race_counts_[race];
+}
+
+/*
+    @param: an output stream
+    @post: writes the report Tavern::tavernReport prints, for the characters of the snapshot
+*/
+void TavernSnapshot::tavernReport(std::ostream &out) const
+{
+    out << "Humans: " << tallyRace(HUMAN) << std::endl;
+    out << "Elves: " << tallyRace(ELF) << std::endl;
+    out << "Dwarves: " << tallyRace(DWARF) << std::endl;
+    out << "Lizards: " << tallyRace(LIZARD) << std::endl;
+    out << "Undead: " << tallyRace(UNDEAD) << std::endl;
+    out << "\nThe average level is: " << calculateAvgLevel() << std::endl;
+    out << std::fixed << std::setprecision(2) << calculateEnemyPercentage() << "% are enemies.\n\n";
+}
+
+/** Default Constructor **/
+ConcurrentTavern::ConcurrentTavern() : tavern_(), level_sum_{0}, num_enemies_{0}, character_count_{0}, epoch_{0}
+{
+    publish();
+}
+
+/*
+    @param: the name of a tavern csv file, read as by the Tavern file constructor
+*/
+ConcurrentTavern::ConcurrentTavern(const std::string &input_file_name) : tavern_(input_file_name), level_sum_{0}, num_enemies_{0}, character_count_{0}, epoch_{0}
+{
+    publish();
+}
+
+/*
+    @post: copies the tavern's counters into the atomic ones
+*/
+void ConcurrentTavern::storeCounters()
+{
+    level_sum_.store(tavern_.getLevelSum(), std::memory_order_release);
+    num_enemies_.store(tavern_.getEnemyCount(), std::memory_order_release);
+    character_count_.store(tavern_.getCurrentSize(), std::memory_order_release);
+}
+
+/*
+    @param: a Character entering the tavern
+    @return: as Tavern::enterTavern
+    @post: on success, updates the counters; snapshot readers see the Character at the next publish()
+*/
+bool ConcurrentTavern::enterTavern(Character *a_character)
+{
+    if (!tavern_.enterTavern(a_character))
+    {
+        return false;
+    }
+    storeCounters();
+    return true;
+}
+
+/*
+    @param: a Character leaving the tavern
+    @return: as Tavern::exitTavern
+    @post: on success, updates the counters; snapshot readers see the Character leave at the next publish()
+*/
+bool ConcurrentTavern::exitTavern(Character *a_character)
+{
+    if (!tavern_.exitTavern(a_character))
+    {
+        return false;
+    }
+    storeCounters();
+    return true;
+}
+
+/*
+    @post: every character eats a tainted stew; snapshot readers see it at the next publish()
+*/
+void ConcurrentTavern::taintedStew()
+{
+    tavern_.taintedStew();
+}
+
+/*
+    @return: the tavern itself, for the writer's other changes
+*/
+Tavern &ConcurrentTavern::getTavern()
+{
+    return tavern_;
+}
+
+/*
+    @post: publishes a snapshot of the tavern as it is now; called by the writer at the end of each tick
+*/
+void ConcurrentTavern::publish()
+{
+    std::shared_ptr<TavernSnapshot> snapshot = std::make_shared<TavernSnapshot>();
+    snapshot->epoch_ = epoch_++;
+    snapshot->level_sum_ = tavern_.getLevelSum();
+    snapshot->num_enemies_ = tavern_.getEnemyCount();
+    ArrayBagView<Character *> characters = tavern_.view();
+    snapshot->characters_.reserve(characters.size());
+    for (Character *character : characters)
+    {
+        snapshot->race_counts_[character->getRaceType()]++;
+        snapshot->characters_.push_back({character->getName(), character->getRaceType(), character->getLevel(),
+                                         character->getVitality(), character->getArmor(), character->isEnemy()});
+    }
+    storeCounters();
+    std::atomic_store_explicit(&snapshot_, std::shared_ptr<const TavernSnapshot>(std::move(snapshot)), std::memory_order_release);
+}
+
+/*
+    @return: the latest published snapshot
+*/
+std::shared_ptr<const TavernSnapshot> ConcurrentTavern::getSnapshot() const
+{
+    return std::atomic_load_explicit(&snapshot_, std::memory_order_acquire);
+}
+
+/*
+    @return: the current level sum
+*/
+int ConcurrentTavern::getLevelSum() const
+{
+    return level_sum_.load(std::memory_order_acquire);
+}
+
+/*
+    @return: the current enemy count
+*/
+int ConcurrentTavern::getEnemyCount() const
+{
+    return num_enemies_.load(std::memory_order_acquire);
+}
+
+/*
+    @return: the current character count
+*/
+int ConcurrentTavern::getCharacterCount() const
+{
+    return character_count_.load(std::memory_order_acquire);
+}
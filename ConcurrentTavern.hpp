@@ -0,0 +1,142 @@
+/*
+ * File Title: ConcurrentTavern.hpp
+ * Author: Mahim Ali
+ * Date: October 19, 2026
+ * This file is the interface of a class called ConcurrentTavern
+ */
+#ifndef CONCURRENT_TAVERN_HPP
+#define CONCURRENT_TAVERN_HPP
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Tavern.hpp"
+
+/*
+    What a reader may know about one Character, copied when a snapshot is published.
+*/
+struct CharacterRecord
+{
+    std::string name_;
+    Race race_;
+    int level_;
+    int vitality_;
+    int armor_;
+    bool enemy_;
+};
+
+/*
+    An immutable copy of a tavern's contents at one moment. Any number of threads may read it at once.
+*/
+struct TavernSnapshot
+{
+    unsigned long long epoch_ = 0;  // number of snapshots published before this one
+    int level_sum_ = 0;
+    int num_enemies_ = 0;
+    int race_counts_[6] = {};       // characters of each Race, indexed by the enum value
+    std::vector<CharacterRecord> characters_;
+
+    /*
+    @return: the number of characters, the average level rounded to the nearest integer,
+             and the percentage of enemies rounded up to 2 decimal places, as Tavern computes them
+    */
+    int getCharacterCount() const;
+    int calculateAvgLevel() const;
+    double calculateEnemyPercentage() const;
+
+    /*
+    @param: a race
+    @return: the number of characters of the race
+    */
+    int tallyRace(Race race) const;
+
+    /*
+    @param: an output stream
+    @post: writes the report Tavern::tavernReport prints, for the characters of the snapshot
+    */
+    void tavernReport(std::ostream &out) const;
+};
+
+/*
+    A Tavern that one game thread changes while any number of other threads read it.
+
+    The game thread (the writer) changes the tavern through this class and calls publish() at the end of each tick,
+    which copies the tavern into a new TavernSnapshot. Copying every character costs as much as the tavern is large,
+    so it is done once a tick rather than after every change. Readers take the latest snapshot with getSnapshot() and
+    read it for as long as they like; they never see a change half done and never hold anything the writer waits for
+    (publishing only swaps a shared_ptr, and the old snapshot is freed by whichever thread lets go of it last).
+    The level sum, enemy count and character count are also kept in atomic counters, updated by every entry and exit,
+    for readers that need one current figure rather than a consistent set.
+
+    Only the writer may call the functions that change the tavern. No change is seen in a snapshot until the writer
+    calls publish().
+*/
+class ConcurrentTavern
+{
+public:
+    ConcurrentTavern();
+
+    /*
+    @param: the name of a tavern csv file, read as by the Tavern file constructor
+    */
+    ConcurrentTavern(const std::string &input_file_name);
+
+    ConcurrentTavern(const ConcurrentTavern &) = delete;
+    ConcurrentTavern &operator=(const ConcurrentTavern &) = delete;
+
+    //------------------------------------------------------------
+    // Writer Section. Only the game thread may call these.
+    //------------------------------------------------------------
+
+    /*
+    @param: a Character entering or leaving the tavern
+    @return: as Tavern::enterTavern and Tavern::exitTavern
+    @post: on success, updates the counters. The change reaches snapshots at the next publish().
+    */
+    bool enterTavern(Character *a_character);
+    bool exitTavern(Character *a_character);
+
+    /*
+    @post: every character eats a tainted stew (Tavern::taintedStew). The change reaches snapshots at the next publish().
+    */
+    void taintedStew();
+
+    /*
+    @return: the tavern itself, for the writer's other changes (combat, main character, ...)
+    */
+    Tavern &getTavern();
+
+    /*
+    @post: publishes a snapshot of the tavern as it is now. The tick boundary: call it once the tick's changes are made.
+    */
+    void publish();
+
+    //------------------------------------------------------------
+    // Reader Section. Any thread may call these at any time.
+    //------------------------------------------------------------
+
+    /*
+    @return: the latest published snapshot, which stays valid for as long as the caller holds it
+    */
+    std::shared_ptr<const TavernSnapshot> getSnapshot() const;
+
+    /*
+    @return: the current level sum, enemy count and character count. Each is exact, but two of them read one after
+             the other may straddle a change; use a snapshot for figures that must agree.
+    */
+    int getLevelSum() const;
+    int getEnemyCount() const;
+    int getCharacterCount() const;
+
+private:
+    Tavern tavern_;
+    std::atomic<int> level_sum_;
+    std::atomic<int> num_enemies_;
+    std::atomic<int> character_count_;
+    unsigned long long epoch_;                       // written by the writer only
+    std::shared_ptr<const TavernSnapshot> snapshot_; // read and replaced only with std::atomic_load / std::atomic_store
+
+    // Helper Function: copies the tavern's counters into the atomic ones
+    void storeCounters();
+};
+#endif // CONCURRENT_TAVERN_HPP
@@ -0,0 +1,212 @@
+/*
+ * File Title: DataGenerator.cpp
+ * Author: Mahim Ali
+ * Date: October 19, 2026
+ * This file implements a class called DataGenerator
+ */
+#include "DataGenerator.hpp"
+
+/*
+    @param: the seed for the random engine
+*/
+DataGenerator::DataGenerator(unsigned seed) : engine_{seed}
+{
+}
+
+/*
+    @param: the lowest and highest value to return
+    @return: a pseudo-random integer in [low, high]
+*/
+int DataGenerator::nextInt(int low, int high)
+{
+    // the modulo bias is negligible for the small ranges used here, and unlike std::uniform_int_distribution
+    // it gives the same numbers with every standard library
+    return low + static_cast<int>(engine_() % static_cast<unsigned>(high - low + 1));
+}
+
+/*
+    @param: a prefix and a number
+    @return: "[prefix]" followed by a distinct uppercase letter code for the number
+*/
+std::string DataGenerator::uniqueName(const std::string &prefix, int n)
+{
+    std::string name = prefix;
+    do
+    {
+        name += char('A' + n % 26);
+        n /= 26;
+    } while (n > 0);
+    return name;
+}
+
+/*
+    @param: a prefix and a number
+    @return: a reference to uniqueName(prefix, n), built in a reused buffer
+*/
+const std::string &DataGenerator::appendName(const char *prefix, int n)
+{
+    name_ = prefix;
+    do
+    {
+        name_ += char('A' + n % 26);
+        n /= 26;
+    } while (n > 0);
+    return name_;
+}
+
+// the values the columns of a tavern row are picked from
+static const char *races[5] = {"HUMAN", "ELF", "DWARF", "LIZARD", "UNDEAD"};
+static const char *schools[3] = {"ELEMENTAL", "NECROMANCY", "ILLUSION"};
+static const char *daggers[7] = {"WOOD", "BRONZE", "IRON", "STEEL", "MITHRIL", "ADAMANT", "RUNE"};
+static const char *factions[3] = {"CUTPURSE", "SHADOWBLADE", "SILVERTONGUE"};
+static const char *elements[4] = {"FIRE", "WATER", "POISON", "BLOOD"};
+
+/*
+    @param: the number of the character, used for its name
+    @return: a newly allocated Mage, Barbarian, Scoundrel or Ranger with valid random attributes
+*/
+Character *DataGenerator::makeCharacter(int n)
+{
+    std::string name = uniqueName("", n);
+    std::string race = races[nextInt(0, 4)];
+    int vitality = nextInt(1, 100);
+    int armor = nextInt(0, 20);
+    int level = nextInt(1, 50);
+    bool enemy = nextInt(0, 1) == 1;
+    switch (nextInt(0, 3))
+    {
+    case 0:
+        return new Mage(name, race, vitality, armor, level, enemy, schools[nextInt(0, 2)], nextInt(0, 1) ? "WAND" : "STAFF", nextInt(0, 1) == 1);
+    case 1:
+        return new Barbarian(name, race, vitality, armor, level, enemy, "AXE", nextInt(0, 1) ? "SHIELD" : "NONE", nextInt(0, 1) == 1);
+    case 2:
+        return new Scoundrel(name, race, vitality, armor, level, enemy, daggers[nextInt(0, 6)], factions[nextInt(0, 2)], nextInt(0, 1) == 1);
+    default:
+    {
+        std::vector<Arrows> arrows = {{"WOOD", nextInt(1, 30)}, {elements[nextInt(0, 3)], nextInt(1, 10)}};
+        std::vector<std::string> affinities = {elements[nextInt(0, 3)]};
+        return new Ranger(name, race, vitality, armor, level, enemy, arrows, affinities, nextInt(0, 1) == 1);
+    }
+    }
+}
+
+/*
+    @param: an output stream and the number of characters to write
+    @post: writes a csv file in the format the Tavern file constructor reads, header line included
+*/
+void DataGenerator::writeTavern(std::ostream &out, int characters)
+{
+    out << "Name,Race,Subclass,Level,Vitality,Armor,Enemy,Main,Offhand,School/Faction,Summoning,Affinity,Disguise,Enraged\n";
+    for (int n = 0; n < characters; n++)
+    {
+        out << appendName("", n) << "," << races[nextInt(0, 4)] << ",";
+        int subclass = nextInt(0, 3);
+        out << (subclass == 0 ? "MAGE" : subclass == 1 ? "BARBARIAN" : subclass == 2 ? "SCOUNDREL" : "RANGER") << ","
+            << nextInt(1, 50) << "," << nextInt(1, 100) << "," << nextInt(0, 20) << "," << nextInt(0, 1) << ",";
+        switch (subclass)
+        {
+        case 0: // Main, Offhand, School, Summoning, Affinity, Disguise, Enraged
+            out << (nextInt(0, 1) ? "WAND" : "STAFF") << ",NONE," << schools[nextInt(0, 2)] << "," << nextInt(0, 1) << ",NONE,0,0\n";
+            break;
+        case 1:
+            out << "AXE," << (nextInt(0, 1) ? "SHIELD" : "NONE") << ",NONE,0,NONE,0," << nextInt(0, 1) << "\n";
+            break;
+        case 2:
+            out << daggers[nextInt(0, 6)] << ",NONE," << factions[nextInt(0, 2)] << ",0,NONE," << nextInt(0, 1) << ",0\n";
+            break;
+        default:
+            out << "WOOD " << nextInt(1, 30);
+            for (int a = nextInt(0, 2); a > 0; a--)
+            {
+                out << ";" << elements[nextInt(0, 3)] << " " << nextInt(1, 10);
+            }
+            out << ",NONE,NONE," << nextInt(0, 1) << "," << elements[nextInt(0, 3)];
+            if (nextInt(0, 1) == 1)
+            {
+                out << ";" << elements[nextInt(0, 3)];
+            }
+            out << ",0,0\n";
+        }
+    }
+}
+
+/*
+    @param: the number of the item, used for its name
+    @return: a newly allocated Item with a random type, level, value and quantity
+*/
+Item *DataGenerator::makeItem(int n)
+{
+    static const ItemType types[3] = {WEAPON, ARMOR, CONSUMABLE};
+    return new Item(uniqueName("ITEM ", n), types[nextInt(0, 2)], nextInt(1, 50), nextInt(1, 1000), nextInt(1, 5));
+}
+
+/*
+    @param: an output stream and the number of items to write
+    @post: writes a csv file in the format the Inventory file constructor reads, header line included
+*/
+void DataGenerator::writeItems(std::ostream &out, int items)
+{
+    static const char *types[3] = {"WEAPON", "ARMOR", "CONSUMABLE"};
+    out << "Name,Type,Level,Value,Quantity\n";
+    for (int n = 0; n < items; n++)
+    {
+        out << appendName("ITEM ", n) << "," << types[nextInt(0, 2)] << "," << nextInt(1, 50) << ","
+            << nextInt(1, 1000) << "," << nextInt(1, 5) << "\n";
+    }
+}
+
+/*
+    @param: an output stream, the number of quests, and the shape of their graph
+    @post: writes a csv file in the format the QuestList file constructor reads, header line included
+*/
+void DataGenerator::writeQuests(std::ostream &out, int quests, const QuestShape &shape)
+{
+    static const char *descriptions[4] = {"Clear the road of bandits", "Bring supplies to the outpost",
+                                          "Escort the caravan through the pass", "Recover the stolen relic"};
+    int chains = std::max(1, shape.chains_);
+    out << "Title,Description,Completion,Experience,Dependencies,Subquests\n";
+    for (int n = 0; n < quests; n++)
+    {
+        out << appendName("QUEST ", n) << "," << descriptions[nextInt(0, 3)] << "," << nextInt(0, 1) << ","
+            << nextInt(0, 100) * 5 << ",";
+
+        int lowest = shape.window_ > 0 ? std::max(0, n - shape.window_) : 0; // earliest quest a dependency may name
+        int dependencies = (n < chains || shape.max_dependencies_ <= 0) ? 0 : nextInt(1, shape.max_dependencies_);
+        if (dependencies == 0)
+        {
+            out << "NONE";
+        }
+        picked_.clear();
+        for (int d = 0; d < dependencies; d++)
+        {
+            int dependency = d == 0 ? n - chains : nextInt(lowest, n - 1);
+            if (std::find(picked_.begin(), picked_.end(), dependency) == picked_.end()) // a quest is listed only once
+            {
+                out << (d == 0 ? "" : ";") << appendName("QUEST ", dependency);
+                picked_.push_back(dependency);
+            }
+        }
+        out << ",";
+
+        bool has_subquests = n > 0 && shape.max_subquests_ > 0 && shape.subquest_every_ > 0 && n % shape.subquest_every_ == 0;
+        int subquests = has_subquests ? nextInt(1, shape.max_subquests_) : 0;
+        if (subquests == 0)
+        {
+            out << "NONE";
+        }
+        for (int s = 0; s < subquests; s++)
+        {
+            out << (s == 0 ? "" : ";");
+            if (nextInt(0, 99) < shape.undiscovered_percent_)
+            {
+                // every subquest slot has its own title, so undiscovered quests are never shared
+                out << appendName("SIDE QUEST ", n * shape.max_subquests_ + s);
+            }
+            else
+            {
+                out << appendName("QUEST ", nextInt(lowest, n - 1));
+            }
+        }
+        out << "\n";
+    }
+}
@@ -0,0 +1,101 @@
+/*
+ * File Title: DataGenerator.hpp
+ * Author: Mahim Ali
+ * Date: October 19, 2026
+ * This file is the interface of a class called DataGenerator
+ */
+#ifndef DATA_GENERATOR_HPP
+#define DATA_GENERATOR_HPP
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "Tavern.hpp"
+#include "Item.hpp"
+
+/*
+    The shape of the dependency and subquest graph written by DataGenerator::writeQuests.
+    Dependencies always point at earlier quests, so the dependency graph never has a cycle.
+*/
+struct QuestShape
+{
+    int max_dependencies_ = 2;       // most dependencies a quest lists, 0 for none
+    int max_subquests_ = 2;          // most subquests a quest lists, 0 for none
+    int subquest_every_ = 3;         // every n-th quest lists subquests, 0 for none
+    int chains_ = 1;                 // quest n's first dependency is quest n - chains_, so there are chains_ independent spines
+    int window_ = 0;                 // other dependencies and subquests are among the window_ quests before, 0 for any earlier quest
+    int undiscovered_percent_ = 50;  // share of subquests that never get a row of their own and load as "NOT DISCOVERED"
+};
+
+/*
+    Makes reproducible synthetic game data for benchmarks and generated worlds.
+    Two generators made with the same seed produce the same characters, items and files, call for call,
+    on every platform (only std::mt19937 and integer arithmetic are used, no std:: distributions).
+*/
+class DataGenerator
+{
+public:
+    /*
+    @param: the seed for the random engine
+    */
+    DataGenerator(unsigned seed = 2023);
+
+    /*
+    @param: the lowest and highest value to return
+    @return: a pseudo-random integer in [low, high]
+    */
+    int nextInt(int low, int high);
+
+    /*
+    @param: a prefix and a number
+    @return: "[prefix]" followed by a distinct uppercase letter code for the number, e.g. uniqueName("QUEST ", 27) is "QUEST BB".
+             Names only use letters and spaces, so they survive Character and Item name cleaning.
+    */
+    static std::string uniqueName(const std::string &prefix, int n);
+
+    /*
+    @param: the number of the character, used for its name
+    @return: a newly allocated Mage, Barbarian, Scoundrel or Ranger with valid random attributes
+    */
+    Character *makeCharacter(int n);
+
+    /*
+    @param: an output stream and the number of characters to write
+    @post: writes a csv file in the format the Tavern file constructor reads, header line included.
+           Rows are written one at a time without allocating Characters, so any number of rows can be streamed.
+    */
+    void writeTavern(std::ostream &out, int characters);
+
+    /*
+    @param: the number of the item, used for its name
+    @return: a newly allocated Item with a random type, level, value and quantity
+    */
+    Item *makeItem(int n);
+
+    /*
+    @param: an output stream and the number of items to write
+    @post: writes a csv file in the format the Inventory file constructor reads, header line included
+    */
+    void writeItems(std::ostream &out, int items);
+
+    /*
+    @param: an output stream, the number of quests, and the shape of their graph
+    @post: writes a csv file in the format the QuestList file constructor reads, header line included.
+           Quest n depends on quest n - chains and on random earlier quests, so the dependencies never form a cycle.
+           Subquests are earlier quests, and "SIDE QUEST" titles that never get a row of their own.
+    */
+    void writeQuests(std::ostream &out, int quests, const QuestShape &shape = QuestShape());
+
+private:
+    std::mt19937 engine_;     // the only source of randomness
+    std::string name_;        // scratch for appendName
+    std::vector<int> picked_; // scratch: the dependencies already written for the current quest
+
+    /*
+    @param: a prefix and a number
+    @return: a reference to uniqueName(prefix, n), built in a reused buffer
+    */
+    const std::string &appendName(const char *prefix, int n);
+};
+#endif // DATA_GENERATOR_HPP
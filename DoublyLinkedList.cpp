@@ -19,9 +19,10 @@ DoublyLinkedList<T>::DoublyLinkedList(const DoublyLinkedList<T> &a_list)
   else
   {
     // Copy first node
-    first_ = new Node<T>();
-    first_->setPrevious(nullptr);
-    first_->setItem(orig_chain_ptr->getItem());
+    first_ = node_pool_.acquire(orig_chain_ptr->getItem());
+    index_.reserve(a_list.index_.size());
+    index_.push_back(first_);
+    size_t position = 0; // of the last node in the new chain
 
     // Copy remaining nodes
     Node<T> *new_chain_ptr = first_;            // Points to last node in new chain
@@ -33,7 +34,7 @@ DoublyLinkedList<T>::DoublyLinkedList(const DoublyLinkedList<T> &a_list)
       T next_item = orig_chain_ptr->getItem();
 
       // Create a new node containing the next item
-      Node<T> *new_node_ptr = new Node<T>(next_item);
+      Node<T> *new_node_ptr = node_pool_.acquire(next_item);
 
       // Link new node to end of new chain
       new_chain_ptr->setNext(new_node_ptr);
@@ -41,6 +42,10 @@ DoublyLinkedList<T>::DoublyLinkedList(const DoublyLinkedList<T> &a_list)
 
       // Advance pointer to new last node
       new_chain_ptr = new_chain_ptr->getNext();
+      if (++position % INDEX_STRIDE == 0)
+      {
+        index_.push_back(new_chain_ptr);
+      }
 
       // Advance original-chain pointer
       orig_chain_ptr = orig_chain_ptr->getNext();
@@ -71,10 +76,26 @@ size_t DoublyLinkedList<T>::getLength() const { return item_count_; }
  @return true always - it always inserts, if position > item_count_ it inserts at end of list */
 template <class T>
 bool DoublyLinkedList<T>::insert(size_t position, const T &new_element)
+{
+  insertNode(position, new_element);
+  return true; // It will always insert, if position > item_count_ it will insert at end
+} // end insert
+
+// same as insert, but returns a pointer to the new node
+template <class T>
+Node<T> *DoublyLinkedList<T>::insertNode(size_t position, const T &new_element)
 {
   // Create a new node containing the new entry and get a pointer to position
-  Node<T> *new_node_ptr = new Node<T>(new_element);
-  Node<T> *pos_ptr = getPointerTo(position);
+  Node<T> *new_node_ptr = node_pool_.acquire(new_element);
+  Node<T> *pos_ptr = nullptr; // appending needs no walk
+  if (position < item_count_)
+  {
+    pos_ptr = getPointerTo(position);
+  }
+  else
+  {
+    position = item_count_;
+  }
 
   // Attach new node to chain
   if (first_ == nullptr)
@@ -111,9 +132,20 @@ bool DoublyLinkedList<T>::insert(size_t position, const T &new_element)
 
   } // end if
 
-  item_count_++; // Increase count of entries
-  return true;   // It will always insert, if pos_ptr is nullptr it will insert at end
-} // end insert
+  indexInserted(position); // nodes from position on move back by one
+  item_count_++;           // Increase count of entries
+  return new_node_ptr;
+} // end insertNode
+
+/**
+ @param new_element to be added at the end of the list
+ @post new_element is the last item in the list. O(1).
+ @return true always */
+template <class T>
+bool DoublyLinkedList<T>::append(const T &new_element)
+{
+  return insert(item_count_, new_element);
+} // end append
 
 /**
  @param position indicating point of deletion
@@ -129,6 +161,8 @@ bool DoublyLinkedList<T>::remove(size_t position)
     return false;
   else
   {
+    indexRemoving(position); // nodes after position move forward by one
+
     // Remove node from chain
 
     if (first_ == last_)
@@ -137,9 +171,8 @@ bool DoublyLinkedList<T>::remove(size_t position)
       first_ = nullptr;
       last_ = nullptr;
 
-      // Return node to the system
-      pos_ptr->setNext(nullptr);
-      delete pos_ptr;
+      // Return node to the pool
+      node_pool_.release(pos_ptr);
       pos_ptr = nullptr;
     }
     else if (pos_ptr == first_)
@@ -148,9 +181,8 @@ bool DoublyLinkedList<T>::remove(size_t position)
       first_ = pos_ptr->getNext();
       first_->setPrevious(nullptr);
 
-      // Return node to the system
-      pos_ptr->setNext(nullptr);
-      delete pos_ptr;
+      // Return node to the pool
+      node_pool_.release(pos_ptr);
       pos_ptr = nullptr;
     }
     else if (pos_ptr == last_)
@@ -159,9 +191,8 @@ bool DoublyLinkedList<T>::remove(size_t position)
       last_ = pos_ptr->getPrevious();
       last_->setNext(nullptr);
 
-      // Return node to the system
-      pos_ptr->setPrevious(nullptr);
-      delete pos_ptr;
+      // Return node to the pool
+      node_pool_.release(pos_ptr);
       pos_ptr = nullptr;
     }
     else
@@ -170,10 +201,8 @@ bool DoublyLinkedList<T>::remove(size_t position)
       pos_ptr->getPrevious()->setNext(pos_ptr->getNext());
       pos_ptr->getNext()->setPrevious(pos_ptr->getPrevious());
 
-      // Return node to the system
-      pos_ptr->setNext(nullptr);
-      pos_ptr->setPrevious(nullptr);
-      delete pos_ptr;
+      // Return node to the pool
+      node_pool_.release(pos_ptr);
       pos_ptr = nullptr;
     }
 
@@ -209,16 +238,16 @@ void DoublyLinkedList<T>::clear()
   {
     first_ = first_->getNext();
 
-    // Return node to the system
-    node_to_delete->setNext(nullptr);
-    node_to_delete->setPrevious(nullptr);
-    delete node_to_delete;
+    // Return node to the pool
+    node_pool_.release(node_to_delete);
 
     node_to_delete = first_;
   } // end while
+  node_pool_.reset(); // refill the slabs in order
   // head_ptr_ is nullptr; node_to_delete is nullptr
   last_ = nullptr;
   item_count_ = 0;
+  index_.clear();
 } // end clear
 
 // position follows classic indexing from 0 to item_count_-1
@@ -226,20 +255,68 @@ void DoublyLinkedList<T>::clear()
 template <class T>
 Node<T> *DoublyLinkedList<T>::getPointerTo(size_t position) const
 {
+  if (position >= item_count_)
+  {
+    return nullptr;
+  }
+
+  // nearest indexed node at or before position
+  size_t entry = position / INDEX_STRIDE;
+  size_t forward = position % INDEX_STRIDE;
+  size_t backward = item_count_ - 1 - position;
 
   Node<T> *find = nullptr;
-  if (position < item_count_)
+  if (backward < forward)
   {
-    find = first_;
-    for (size_t i = 0; i < position; ++i)
+    // closer to the tail
+    find = last_;
+    for (size_t i = 0; i < backward; ++i)
     {
-      find = find->getNext();
+      find = find->getPrevious();
     }
+    return find;
   }
 
+  find = index_[entry];
+  for (size_t i = 0; i < forward; ++i)
+  {
+    find = find->getNext();
+  }
   return find;
 } // end getPointerTo
 
+// @pre the new node has just been linked in at position, and item_count_ does not count it yet
+// @post index_ is correct for the list with the new node
+template <class T>
+void DoublyLinkedList<T>::indexInserted(size_t position)
+{
+  // every indexed position from position on now holds the node before the one it pointed to
+  for (size_t entry = (position + INDEX_STRIDE - 1) / INDEX_STRIDE; entry < index_.size(); entry++)
+  {
+    index_[entry] = index_[entry]->getPrevious();
+  }
+  if (item_count_ % INDEX_STRIDE == 0) // the new last position is indexed
+  {
+    index_.push_back(last_);
+  }
+} // end indexInserted
+
+// @pre the node at position is still linked in
+// @post index_ is correct for the list without that node
+template <class T>
+void DoublyLinkedList<T>::indexRemoving(size_t position)
+{
+  // every indexed position from position on now holds the node after the one it pointed to
+  for (size_t entry = (position + INDEX_STRIDE - 1) / INDEX_STRIDE; entry < index_.size(); entry++)
+  {
+    index_[entry] = index_[entry]->getNext();
+  }
+  if (!index_.empty() && index_.back() == nullptr) // the last position was indexed
+  {
+    index_.pop_back();
+  }
+} // end indexRemoving
+
 // return head node
 template <class T>
 Node<T> *DoublyLinkedList<T>::getHeadNode() const
@@ -247,6 +324,20 @@ Node<T> *DoublyLinkedList<T>::getHeadNode() const
   return first_;
 }
 
+/**@return an iterator to the first item */
+template <class T>
+typename DoublyLinkedList<T>::iterator DoublyLinkedList<T>::begin() const
+{
+  return iterator(first_, this);
+}
+
+/**@return an iterator past the last item */
+template <class T>
+typename DoublyLinkedList<T>::iterator DoublyLinkedList<T>::end() const
+{
+  return iterator(nullptr, this);
+}
+
 template <class T>
 void DoublyLinkedList<T>::display()
 {
@@ -287,9 +378,18 @@ void DoublyLinkedList<T>::swapNode(int i, int j)
   }
 
   Node<T> *ptr_i = getPointerTo(i);
+  Node<T> *ptr_j = getPointerTo(j);
+  // the nodes at i and j trade places, every other position is unchanged
+  if (i % INDEX_STRIDE == 0 && i / INDEX_STRIDE < index_.size())
+  {
+    index_[i / INDEX_STRIDE] = ptr_j;
+  }
+  if (j % INDEX_STRIDE == 0 && j / INDEX_STRIDE < index_.size())
+  {
+    index_[j / INDEX_STRIDE] = ptr_i;
+  }
   Node<T> *ptr_i_next = ptr_i->getNext();
   Node<T> *ptr_i_prev = ptr_i->getPrevious();
-  Node<T> *ptr_j = getPointerTo(j);
   Node<T> *ptr_j_next = ptr_j->getNext();
   Node<T> *ptr_j_prev = ptr_j->getPrevious();
 
@@ -2,7 +2,9 @@
 #define LIST_H_
 #include <iostream>
 #include <algorithm>
+#include <vector>
 #include "Node.hpp"
+#include "NodePool.hpp"
 
 template <class T>
 class DoublyLinkedList
@@ -24,7 +26,13 @@ public:
       @param new_element to be inserted in list
       @post new_element is added at position in list (the node previously at that position is now at position+1)
       @return true always - it always inserts, if position > item_count_ it inserts at end of list */
-   bool insert(size_t position, const T &new_element);
+   virtual bool insert(size_t position, const T &new_element);
+
+   /**
+      @param new_element to be added at the end of the list
+      @post new_element is the last item in the list. O(1).
+      @return true always */
+   bool append(const T &new_element);
 
    /**
       @param position indicating point of deletion
@@ -38,6 +46,9 @@ public:
    T getItem(size_t position) const;
 
    // if position > item_count_ returns nullptr
+   // Uses the position index (see index_) and walks from whichever of the nearest
+   // indexed node or the tail is closer, so positional access is O(INDEX_STRIDE)
+   // rather than O(position). It only reads the list, so concurrent const access is safe.
    Node<T> *getPointerTo(size_t position) const;
 
    /**
@@ -51,14 +62,75 @@ public:
    // added to Project 5
    virtual void display();
 
-   void swapNode(int i, int j);
-
-   void swap(int i, int j);
+   virtual void swapNode(int i, int j);
+
+   virtual void swap(int i, int j);
+
+   // Bidirectional iterator over the items of the list, in order
+   class iterator
+   {
+   public:
+      iterator(Node<T> *node, const DoublyLinkedList<T> *list) : node_{node}, list_{list} {}
+      T operator*() const { return node_->getItem(); }
+      iterator &operator++()
+      {
+         node_ = node_->getNext();
+         return *this;
+      }
+      iterator operator++(int)
+      {
+         iterator old = *this;
+         ++*this;
+         return old;
+      }
+      iterator &operator--() // decrementing end() gives the last item
+      {
+         node_ = (node_ == nullptr) ? list_->last_ : node_->getPrevious();
+         return *this;
+      }
+      iterator operator--(int)
+      {
+         iterator old = *this;
+         --*this;
+         return old;
+      }
+      bool operator==(const iterator &rhs) const { return node_ == rhs.node_; }
+      bool operator!=(const iterator &rhs) const { return node_ != rhs.node_; }
+      Node<T> *getNode() const { return node_; }
+
+   private:
+      Node<T> *node_;                      // current node, nullptr for end()
+      const DoublyLinkedList<T> *list_;   // the list, so end() can step back to last_
+   };
+
+   /**@return an iterator to the first item */
+   iterator begin() const;
+
+   /**@return an iterator past the last item */
+   iterator end() const;
 
 protected:
+   // same as insert, but returns a pointer to the new node
+   Node<T> *insertNode(size_t position, const T &new_element);
+
    Node<T> *first_;    // Pointer to first node
    Node<T> *last_;     // Pointer to last node
    size_t item_count_; // number of items in the list
+   NodePool<T> node_pool_; // nodes come from here rather than new/delete, so a list's nodes sit close together
+
+   // Position index: index_[k] points to the node at position k * INDEX_STRIDE, for every such position.
+   // Only the mutating functions change it: insert and remove move each entry after the position
+   // by one node (O(item_count_ / INDEX_STRIDE)), and swapNode patches the two entries it moves.
+   static const size_t INDEX_STRIDE = 32;
+   std::vector<Node<T> *> index_;
+
+   // @pre the new node has just been linked in at position, and item_count_ does not count it yet
+   // @post index_ is correct for the list with the new node
+   void indexInserted(size_t position);
+
+   // @pre the node at position is still linked in
+   // @post index_ is correct for the list without that node
+   void indexRemoving(size_t position);
 
 }; // end List
 
@@ -0,0 +1,189 @@
+/*
+ * File Title: Instrumentation.cpp
+ * Author: Mahim Ali
+ * Date: October 19, 2026
+ * This file implements a class called Instrumentation
+ */
+#include "Instrumentation.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+
+/*
+    @return: the mutex guarding the probe names and the list of thread counters
+*/
+std::mutex &Instrumentation::registryMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+/*
+    @return: the registered names, by probe id
+*/
+std::vector<const char *> &Instrumentation::probeNames()
+{
+    static std::vector<const char *> names;
+    return names;
+}
+
+/*
+    @return: the counters of every thread that has recorded a call
+*/
+std::vector<std::unique_ptr<Instrumentation::ThreadCounters>> &Instrumentation::threadCounters()
+{
+    static std::vector<std::unique_ptr<ThreadCounters>> counters;
+    return counters;
+}
+
+/*
+    @return: the counters of the calling thread, created and registered on its first call
+*/
+Instrumentation::ThreadCounters &Instrumentation::localCounters()
+{
+    thread_local ThreadCounters *local = nullptr;
+    if (local == nullptr)
+    {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        threadCounters().push_back(std::make_unique<ThreadCounters>());
+        local = threadCounters().back().get();
+    }
+    return *local;
+}
+
+/*
+    @param: the name of a counter or timer, which must outlive the program (a string literal)
+    @return: the id of the name, registering it the first time; -1 if MAX_PROBES names are already registered
+*/
+int Instrumentation::registerProbe(const char *name)
+{
+    std::lock_guard<std::mutex> lock(registryMutex());
+    std::vector<const char *> &names = probeNames();
+    for (size_t i = 0; i < names.size(); i++)
+    {
+        if (std::strcmp(names[i], name) == 0) // the same name used in two places shares one probe
+        {
+            return i;
+        }
+    }
+    if (names.size() == MAX_PROBES)
+    {
+        return -1;
+    }
+    names.push_back(name);
+    return names.size() - 1;
+}
+
+/*
+    @param: the id of a probe
+    @post: adds one call to the probe for the calling thread
+*/
+void Instrumentation::count(int probe)
+{
+    if (probe < 0)
+    {
+        return;
+    }
+    bump(localCounters().probes_[probe].calls_, 1);
+}
+
+/*
+    @param: the id of a probe and the time one call took
+    @post: adds one call, its time and its histogram bucket to the probe for the calling thread
+*/
+void Instrumentation::record(int probe, std::uint64_t nanoseconds)
+{
+    if (probe < 0)
+    {
+        return;
+    }
+    ProbeCounters &counters = localCounters().probes_[probe];
+    bump(counters.calls_, 1);
+    bump(counters.nanoseconds_, nanoseconds);
+    if (nanoseconds > counters.max_nanoseconds_.load(std::memory_order_relaxed))
+    {
+        counters.max_nanoseconds_.store(nanoseconds, std::memory_order_relaxed);
+    }
+    int bucket = 0;
+    for (std::uint64_t rest = nanoseconds >> 1; rest > 0 && bucket < BUCKETS - 1; rest >>= 1)
+    {
+        bucket++;
+    }
+    bump(counters.buckets_[bucket], 1);
+}
+
+/*
+    @param: an output stream
+    @post: prints one line per probe that was called, summed over every thread
+*/
+void Instrumentation::report(std::ostream &out)
+{
+    std::lock_guard<std::mutex> lock(registryMutex());
+    const std::vector<const char *> &names = probeNames();
+    for (size_t probe = 0; probe < names.size(); probe++)
+    {
+        std::uint64_t calls = 0, nanoseconds = 0, max_nanoseconds = 0, buckets[BUCKETS] = {};
+        for (const std::unique_ptr<ThreadCounters> &thread : threadCounters())
+        {
+            const ProbeCounters &counters = thread->probes_[probe];
+            calls += counters.calls_.load(std::memory_order_relaxed);
+            nanoseconds += counters.nanoseconds_.load(std::memory_order_relaxed);
+            max_nanoseconds = std::max(max_nanoseconds, counters.max_nanoseconds_.load(std::memory_order_relaxed));
+            for (int b = 0; b < BUCKETS; b++)
+            {
+                buckets[b] += counters.buckets_[b].load(std::memory_order_relaxed);
+            }
+        }
+        if (calls == 0)
+        {
+            continue;
+        }
+        out << std::left << std::setw(40) << names[probe] << std::right << " calls: " << calls;
+        std::uint64_t timed = 0;
+        for (int b = 0; b < BUCKETS; b++)
+        {
+            timed += buckets[b];
+        }
+        if (timed > 0) // a timer, not just a counter
+        {
+            std::uint64_t percentiles[2] = {0, 0};
+            std::uint64_t wanted[2] = {(timed + 1) / 2, timed - timed / 100};
+            std::uint64_t seen = 0;
+            for (int b = 0, p = 0; b < BUCKETS && p < 2; b++)
+            {
+                seen += buckets[b];
+                while (p < 2 && seen >= wanted[p])
+                {
+                    percentiles[p++] = std::uint64_t(2) << b;
+                }
+            }
+            out << " total: " << std::fixed << std::setprecision(3) << nanoseconds / 1e6 << " ms"
+                << " mean: " << nanoseconds / timed << " ns"
+                << " p50: " << percentiles[0] << " ns"
+                << " p99: " << percentiles[1] << " ns"
+                << " max: " << max_nanoseconds << " ns";
+        }
+        out << std::endl;
+    }
+}
+
+/*
+    @post: sets every counter of every thread back to 0
+*/
+void Instrumentation::reset()
+{
+    std::lock_guard<std::mutex> lock(registryMutex());
+    for (const std::unique_ptr<ThreadCounters> &thread : threadCounters())
+    {
+        for (ProbeCounters &counters : thread->probes_)
+        {
+            counters.calls_.store(0, std::memory_order_relaxed);
+            counters.nanoseconds_.store(0, std::memory_order_relaxed);
+            counters.max_nanoseconds_.store(0, std::memory_order_relaxed);
+            for (std::atomic<std::uint64_t> &bucket : counters.buckets_)
+            {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+}
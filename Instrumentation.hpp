@@ -0,0 +1,140 @@
+/*
+ * File Title: Instrumentation.hpp
+ * Author: Mahim Ali
+ * Date: October 19, 2026
+ * This file is the interface of a class called Instrumentation
+ */
+#ifndef INSTRUMENTATION_HPP
+#define INSTRUMENTATION_HPP
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/*
+    Call counters and latency timers for the hot paths of the game.
+
+    Code is instrumented with two macros, which compile to nothing unless RPG_INSTRUMENTATION is defined:
+        RPG_TIME_SCOPE("Tavern::combat");   // counts the call and times it until the end of the enclosing scope
+        RPG_COUNT("Tavern::combat round");  // counts an event
+    Each macro registers its name once, the first time it runs. After that a call only touches counters owned by the
+    calling thread, with relaxed atomic stores (no locks, no shared cache lines), so threads never slow each other down.
+    Instrumentation::report(std::cout) sums every thread's counters into a per-name table of calls and latencies.
+*/
+class Instrumentation
+{
+public:
+    static const int MAX_PROBES = 64; // most distinct names; later names are ignored
+    static const int BUCKETS = 40;    // latency histogram bucket b counts calls that took [2^b, 2^(b+1)) nanoseconds
+
+    /*
+    @param: the name of a counter or timer, which must outlive the program (a string literal)
+    @return: the id of the name, registering it the first time; -1 if MAX_PROBES names are already registered
+    */
+    static int registerProbe(const char *name);
+
+    /*
+    @param: the id of a probe
+    @post: adds one call to the probe for the calling thread
+    */
+    static void count(int probe);
+
+    /*
+    @param: the id of a probe and the time one call took
+    @post: adds one call, its time and its histogram bucket to the probe for the calling thread
+    */
+    static void record(int probe, std::uint64_t nanoseconds);
+
+    /*
+    @param: an output stream
+    @post: prints one line per probe that was called, summed over every thread:
+           "[NAME] calls: [CALLS] total: [MS] ms mean: [NS] ns p50: [NS] ns p99: [NS] ns max: [NS] ns"
+           The percentiles are the upper bounds of their histogram buckets, so they are exact to a factor of 2.
+           Counters (RPG_COUNT) only report their calls.
+    */
+    static void report(std::ostream &out);
+
+    /*
+    @post: sets every counter of every thread back to 0. Calls made while it runs may be partly lost.
+    */
+    static void reset();
+
+    /*
+        Times the enclosing scope and records it on destruction.
+    */
+    class ScopedTimer
+    {
+    public:
+        ScopedTimer(int probe) : probe_{probe}, start_{std::chrono::steady_clock::now()}
+        {
+        }
+        ~ScopedTimer()
+        {
+            record(probe_, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_).count());
+        }
+        ScopedTimer(const ScopedTimer &) = delete;
+        ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+    private:
+        int probe_;
+        std::chrono::steady_clock::time_point start_;
+    };
+
+private:
+    // The counters of one probe for one thread. Only the owning thread writes them.
+    struct ProbeCounters
+    {
+        std::atomic<std::uint64_t> calls_{0};
+        std::atomic<std::uint64_t> nanoseconds_{0};
+        std::atomic<std::uint64_t> max_nanoseconds_{0};
+        std::atomic<std::uint64_t> buckets_[BUCKETS] = {};
+    };
+
+    // The counters of every probe for one thread, kept alive until the program ends so a report
+    // still includes threads that have finished.
+    struct ThreadCounters
+    {
+        ProbeCounters probes_[MAX_PROBES];
+    };
+
+    static std::mutex &registryMutex();
+    static std::vector<const char *> &probeNames();
+    static std::vector<std::unique_ptr<ThreadCounters>> &threadCounters();
+    static ThreadCounters &localCounters();
+
+    // Helper Function: adds to a counter only the calling thread writes, without a read-modify-write instruction
+    static void bump(std::atomic<std::uint64_t> &counter, std::uint64_t amount)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+};
+
+#define RPG_INSTRUMENTATION_JOIN_(a, b) a##b
+#define RPG_INSTRUMENTATION_JOIN(a, b) RPG_INSTRUMENTATION_JOIN_(a, b)
+
+#ifdef RPG_INSTRUMENTATION
+#define RPG_TIME_SCOPE(name)                                                                                    \
+    static const int RPG_INSTRUMENTATION_JOIN(rpg_probe_, __LINE__) = Instrumentation::registerProbe(name); \
+    Instrumentation::ScopedTimer RPG_INSTRUMENTATION_JOIN(rpg_timer_, __LINE__)(RPG_INSTRUMENTATION_JOIN(rpg_probe_, __LINE__))
+#define RPG_COUNT(name)                                                    \
+    do                                                                     \
+    {                                                                      \
+        static const int rpg_probe = Instrumentation::registerProbe(name); \
+        Instrumentation::count(rpg_probe);                                 \
+    } while (false)
+#else
+#define RPG_TIME_SCOPE(name) \
+    do                       \
+    {                        \
+    } while (false)
+#define RPG_COUNT(name) \
+    do                  \
+    {                   \
+    } while (false)
+#endif
+
+#endif // INSTRUMENTATION_HPP
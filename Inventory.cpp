@@ -6,6 +6,73 @@
  */
 #include "Inventory.hpp"
 
+/**
+Default Constructor
+*/
+Inventory::Inventory() : BinarySearchTree<Item *>(), backend_{BST_BACKEND}
+{
+}
+
+/**
+ * @param : The storage the inventory should use.
+ * @post  : Creates an empty inventory with the given backend.
+ */
+Inventory::Inventory(InventoryBackend backend) : BinarySearchTree<Item *>(), backend_{backend}
+{
+}
+
+/**
+ * @param : A reference to a vector of Item pointers, in any order, and the storage the inventory should use.
+ * @post  : The inventory holds the given items, added with addItems(). With BST_BACKEND the tree is perfectly balanced.
+ */
+Inventory::Inventory(const std::vector<Item *> &items, InventoryBackend backend) : BinarySearchTree<Item *>(), backend_{backend}
+{
+     addItems(items);
+}
+
+/**
+@param: a reference to string name of an input file
+@pre: Formatting of the csv file is as follows:
+    Name: A string
+    Type: An uppercase string [WEAPON, ARMOR, CONSUMABLE, UNKNOWN]
+    Level: A non negative integer
+    Value: A non negative integer
+    Quantity: A positive integer
+Notes:
+    - The first line of the input file is a header and should be ignored.
+@post: Each line of the input file corresponds to an Item that is dynamically allocated and added to the inventory with addItems().
+       Items that addItems() does not take are deleted.
+*/
+Inventory::Inventory(const std::string &input_file_name, InventoryBackend backend) : BinarySearchTree<Item *>(), backend_{backend}
+{
+     std::string junk, line, name, type_str, level_str, value_str, quantity_str;
+     std::vector<Item *> items;
+     std::ifstream fin(input_file_name); // opens the input file
+     if (fin.fail())                     // error message if input file doesn't open
+     {
+          std::cerr << "File cannot be opened for reading." << std::endl;
+          exit(1);
+     }
+     getline(fin, junk); // ignores header line of the csv file.
+     while (getline(fin, line))
+     {
+          std::istringstream item(line);
+          getline(item, name, ',');
+          getline(item, type_str, ',');
+          getline(item, level_str, ',');
+          getline(item, value_str, ',');
+          getline(item, quantity_str, ',');
+          items.push_back(new Item(name, parseItemType(type_str), std::stoi(level_str), std::stoi(value_str), std::stoi(quantity_str)));
+     }
+     fin.close();
+     std::vector<Item *> rejected;
+     addItems(items, &rejected);
+     for (Item *item : rejected)
+     {
+          delete item;
+     }
+}
+
 /**
  * @param : A Pointer to the Item object to be added to the inventory.
  * @post  : The Item is added to the inventory, preserving the BST structure. The BST property is based on (ascending) alphabetical order of the item's name.
@@ -15,25 +82,118 @@
  */
 bool Inventory::addItem(Item *add)
 {
-     if (((add->getType() == "UNKNOWN") || (add->getType() == "WEAPON") || (add->getType() == "ARMOR")) && contains(add))
+     RPG_TIME_SCOPE("Inventory::addItem");
+     RPG_ALLOCATION_SCOPE("Inventory::addItem");
+     Item *existing = nullptr;
+     if (backend_ == FLAT_BACKEND)
      {
-          return false;
+          auto position = flatLowerBound(add);
+          if (position == flat_items_.end() || !((*position)->operator==(*add)))
+          {
+               flat_items_.insert(position, add);
+               return true;
+          }
+          existing = *position;
      }
-     if (contains(add))
+     else
      {
-          if (add->getType() == "CONSUMABLE")
+          std::shared_ptr<BinaryNode<Item *>> found = getPointerTo(add);
+          if (found == nullptr)
           {
-               findItem(add->getName())->setQuantity(add->getQuantity() + findItem(add->getName())->getQuantity());
-               findItem(add->getName())->updateTimePickedUp();
+               this->add(add);
                return true;
           }
+          existing = found->getItem();
      }
-     else
+     if (add->getItemType() == CONSUMABLE)
      {
-          this->add(add);
+          RPG_COUNT("Inventory::addItem consumable merge");
+          existing->setQuantity(add->getQuantity() + existing->getQuantity());
+          existing->updateTimePickedUp();
           return true;
      }
-     return false;
+     return false; // UNKNOWN, WEAPON and ARMOR items are not added twice
+}
+
+/**
+ * @param : A reference to a vector of Item pointers, in any order.
+ * @post  : Every item is added as if by addItem(), in the order given: duplicates of UNKNOWN, WEAPON or ARMOR items are ignored,
+            and repeated CONSUMABLE items have their quantities combined into the first instance, updating its time_picked_up_.
+            The incoming items are sorted and merged with the current contents, and the tree is then rebuilt perfectly balanced in O(n).
+ *          If rejected is given, every item the inventory did not take is appended to it, so the caller can delete it.
+ * @return : The number of items that were added to the inventory or updated.
+ */
+int Inventory::addItems(const std::vector<Item *> &items, std::vector<Item *> *rejected)
+{
+     std::vector<Item *> incoming;
+     incoming.reserve(items.size());
+     for (size_t i = 0; i < items.size(); i++)
+     {
+          if (items[i] != nullptr)
+          {
+               incoming.push_back(items[i]);
+          }
+     }
+     // stable, so items with the same name keep the order they were given in
+     std::stable_sort(incoming.begin(), incoming.end(), [](Item *a, Item *b)
+                      { return a->operator<(*b); });
+
+     std::vector<Item *> existing;
+     collectItems(existing);
+
+     std::vector<Item *> merged;
+     merged.reserve(existing.size() + incoming.size());
+     int changed = 0;
+     size_t e = 0;
+     size_t i = 0;
+     while (i < incoming.size())
+     {
+          // copy over existing items that sort before the next incoming name
+          while (e < existing.size() && existing[e]->operator<(*incoming[i]))
+          {
+               merged.push_back(existing[e++]);
+          }
+          Item *kept = nullptr; // the item already holding this name, if any
+          if (e < existing.size() && existing[e]->operator==(*incoming[i]))
+          {
+               kept = existing[e++];
+          }
+          else
+          {
+               kept = incoming[i++];
+               changed++;
+          }
+          // the rest of the run of equal names behaves like repeated addItem() calls
+          while (i < incoming.size() && incoming[i]->operator==(*kept))
+          {
+               if (incoming[i]->getItemType() == CONSUMABLE)
+               {
+                    kept->setQuantity(incoming[i]->getQuantity() + kept->getQuantity());
+                    kept->updateTimePickedUp();
+                    changed++;
+               }
+               if (rejected != nullptr && incoming[i] != kept) // the same Item given twice is still in the inventory
+               {
+                    rejected->push_back(incoming[i]);
+               }
+               i++;
+          }
+          merged.push_back(kept);
+     }
+     while (e < existing.size())
+     {
+          merged.push_back(existing[e++]);
+     }
+
+     if (backend_ == FLAT_BACKEND)
+     {
+          flat_items_.swap(merged);
+     }
+     else
+     {
+          buildFromSorted(merged);
+     }
+     return changed;
 }
 
 /**
@@ -42,10 +202,22 @@ bool Inventory::addItem(Item *add)
  */
 Item *Inventory::findItem(const std::string &find) const
 {
-     Item *name = new Item(find, UNKNOWN, 0, 0, 0);
-     if (contains(name))
+     RPG_ALLOCATION_SCOPE("Inventory::findItem");
+     static thread_local InternedName probe_name; // reused, so looking up a name neither interns it nor allocates
+     Item name(find, probe_name);
+     if (backend_ == FLAT_BACKEND)
      {
-          return getPointerTo(name)->getItem();
+          auto position = flatLowerBound(&name);
+          if (position != flat_items_.end() && (*position)->operator==(name))
+          {
+               return *position;
+          }
+          return nullptr;
+     }
+     std::shared_ptr<BinaryNode<Item *>> found = getPointerTo(&name);
+     if (found != nullptr)
+     {
+          return found->getItem();
      }
      return nullptr;
 }
@@ -58,29 +230,28 @@ If a CONSUMABLE is removed, its quantity is decremented by one, but its time_pic
 */
 bool Inventory::removeItem(const std::string &remove)
 {
-     Item *name = new Item(remove, UNKNOWN, 0, 0, 0);
-     if (contains(name))
+     static thread_local InternedName probe_name; // reused, so removing a name neither interns it nor allocates
+     Item name(remove, probe_name);
+     Item *existing = findItem(name.getName());
+     if (existing == nullptr)
      {
-          if (findItem(name->getName())->getType() != "CONSUMABLE")
-          {
-               this->remove(name);
-               return true;
-          }
-          else if (findItem(name->getName())->getType() == "CONSUMABLE")
-          {
-               if (findItem(name->getName())->getQuantity() == 1)
-               {
-                    this->remove(name);
-                    return true;
-               }
-               else
-               {
-                    findItem(name->getName())->setQuantity(findItem(name->getName())->getQuantity() - 1);
-                    return true;
-               }
-          }
+          return false;
+     }
+     if (existing->getItemType() == CONSUMABLE && existing->getQuantity() > 1)
+     {
+          existing->setQuantity(existing->getQuantity() - 1);
+          return true;
      }
-     return false;
+     // non-CONSUMABLE items, and the last of a CONSUMABLE
+     if (backend_ == FLAT_BACKEND)
+     {
+          flat_items_.erase(flatLowerBound(&name));
+     }
+     else
+     {
+          this->remove(&name);
+     }
+     return true;
 }
 /**
  * @return: The total sum of gold values of all items in the inventory.
@@ -89,9 +260,90 @@ added for each item
  */
 int Inventory::getTotalGoldValue()
 {
+     if (backend_ == FLAT_BACKEND)
+     {
+          int total = 0;
+          for (size_t i = 0; i < flat_items_.size(); i++)
+          {
+               total += flat_items_[i]->getGoldValue() * flat_items_[i]->getQuantity(); // quantity is 1 for non-consumables
+          }
+          return total;
+     }
      return goldItem(getRoot());
 }
 
+/**
+ * @return : The storage the inventory uses.
+ */
+InventoryBackend Inventory::getBackend() const
+{
+     return backend_;
+}
+
+/**
+ * @return : The number of distinct items in the inventory, for either backend.
+ */
+int Inventory::getItemCount() const
+{
+     if (backend_ == FLAT_BACKEND)
+     {
+          return flat_items_.size();
+     }
+     return BinarySearchTree<Item *>::getNumberOfNodes();
+}
+
+/**
+ * @return : The number of distinct items in the inventory, for either backend (the same as getItemCount()).
+ */
+int Inventory::getNumberOfNodes() const
+{
+     return getItemCount();
+}
+
+/**
+ * @return : True if the inventory holds no items, for either backend.
+ */
+bool Inventory::isEmpty() const
+{
+     return getItemCount() == 0;
+}
+
+// Helper Function
+ItemType Inventory::parseItemType(const std::string &type) const
+{
+     if (type == "WEAPON")
+     {
+          return WEAPON;
+     }
+     else if (type == "ARMOR")
+     {
+          return ARMOR;
+     }
+     else if (type == "CONSUMABLE")
+     {
+          return CONSUMABLE;
+     }
+     return UNKNOWN;
+}
+
+// Helper Function
+int Inventory::typeOrder(ItemType type)
+{
+     // position of the type's name in alphabetical order, so sorting on the enum
+     // gives the same order as sorting on getType()
+     switch (type)
+     {
+     case ARMOR:
+          return 0;
+     case CONSUMABLE:
+          return 1;
+     case WEAPON:
+          return 3;
+     default:
+          return 2; // UNKNOWN
+     }
+}
+
 // Helper Function
 int Inventory::goldItem(std::shared_ptr<BinaryNode<Item *>> Gold)
 {
@@ -99,7 +351,7 @@ int Inventory::goldItem(std::shared_ptr<BinaryNode<Item *>> Gold)
      {
           return 0;
      }
-     if (Gold->getItem()->getType() == "CONSUMABLE" && Gold->getItem()->getQuantity() > 1)
+     if (Gold->getItem()->getItemType() == CONSUMABLE && Gold->getItem()->getQuantity() > 1)
      {
           return (Gold->getItem()->getGoldValue() * Gold->getItem()->getQuantity()) + (goldItem(Gold->getLeftChildPtr())) + (goldItem(Gold->getRightChildPtr()));
      }
@@ -129,7 +381,7 @@ Quantity: 2
 void Inventory::printInventoryInOrder()
 {
      std::vector<Item *> my_vector;
-     inorderTraversal(my_vector, getRoot());
+     collectItems(my_vector);
      std::sort(my_vector.begin(), my_vector.end(), [this](Item *a, Item *b) // use of lambda expression to sort based on name ascending
                { return a->operator<(*b); });
      for (int i = 0; i < my_vector.size(); i++)
@@ -145,7 +397,7 @@ void Inventory::printItemDetails(Item *item)
                << "(" << item->getType() << ")" << std::endl;
      std::cout << "Level: " << item->getLevel() << std::endl;
      std::cout << "Value: " << item->getGoldValue() << std::endl;
-     if (item->getType() == "CONSUMABLE")
+     if (item->getItemType() == CONSUMABLE)
      {
           std::cout << "Quantity: " << item->getQuantity() << std::endl;
      }
@@ -153,7 +405,7 @@ void Inventory::printItemDetails(Item *item)
 }
 
 // Helper Function
-void Inventory::inorderTraversal(std::vector<Item *> &my_vector, std::shared_ptr<BinaryNode<Item *>> name)
+void Inventory::inorderTraversal(std::vector<Item *> &my_vector, std::shared_ptr<BinaryNode<Item *>> name) const
 {
      if (name == NULL)
      {
@@ -248,11 +500,159 @@ void Inventory::printInventory(const bool &print, const std::string &inventory)
      }
 }
 
+/**
+ * @param   : References to strings naming the low and high ends of the range (inclusive).
+ * @return  : The items whose names fall within [low, high], in ascending order of name.
+ * Only the part of the tree overlapping the range is visited, so this is O(log n + k) for k results.
+ */
+std::vector<Item *> Inventory::getItemsInRange(const std::string &low, const std::string &high) const
+{
+     static thread_local InternedName low_name, high_name; // reused, so the bounds are never interned
+     Item low_item(low, low_name);
+     Item high_item(high, high_name);
+     std::vector<Item *> my_vector;
+     if (backend_ == FLAT_BACKEND)
+     {
+          if (!low_item.operator>(high_item))
+          {
+               my_vector.assign(flatLowerBound(&low_item), flatUpperBound(&high_item));
+          }
+          return my_vector;
+     }
+     rangeSearch(&low_item, &high_item, my_vector);
+     return my_vector;
+}
+
+/**
+ * @param   : References to strings naming the low and high ends of the range (inclusive).
+ * @return  : The number of items whose names fall within [low, high], in O(log n).
+ */
+int Inventory::countItemsInRange(const std::string &low, const std::string &high) const
+{
+     static thread_local InternedName low_name, high_name; // reused, so counting does not allocate
+     Item low_item(low, low_name);
+     Item high_item(high, high_name);
+     if (backend_ == FLAT_BACKEND)
+     {
+          if (low_item.operator>(high_item))
+          {
+               return 0;
+          }
+          return flatUpperBound(&high_item) - flatLowerBound(&low_item);
+     }
+     return countRange(&low_item, &high_item);
+}
+
+/**
+ * @param   : The 0-based position k of an item in ascending order of name.
+ * @return  : A pointer to the k-th item by name, or nullptr if k is out of range.
+ */
+Item *Inventory::getItemAt(int k) const
+{
+     if (backend_ == FLAT_BACKEND)
+     {
+          return (k >= 0 && static_cast<size_t>(k) < flat_items_.size()) ? flat_items_[k] : nullptr;
+     }
+     return select(k);
+}
+
+/**
+ * @param   : A reference to string name of an item.
+ * @return  : The number of items whose names come before the given name.
+ */
+int Inventory::getRankOf(const std::string &name) const
+{
+     static thread_local InternedName probe_name; // reused, so ranking does not allocate
+     Item name_item(name, probe_name);
+     if (backend_ == FLAT_BACKEND)
+     {
+          return flatLowerBound(&name_item) - flat_items_.begin();
+     }
+     return getRank(&name_item);
+}
+
+/**
+ * @param   : The 0-based position of the first item on the page, and the page size.
+ * @return  : Up to count items in ascending order of name, starting at position first.
+ */
+std::vector<Item *> Inventory::getItemPage(int first, int count) const
+{
+     std::vector<Item *> my_vector;
+     if (backend_ == FLAT_BACKEND)
+     {
+          if (first < 0)
+          {
+               count += first;
+               first = 0;
+          }
+          int size = flat_items_.size();
+          if (count > 0 && first < size)
+          {
+               int last = (count > size - first) ? size : first + count;
+               my_vector.assign(flat_items_.begin() + first, flat_items_.begin() + last);
+          }
+          return my_vector;
+     }
+     selectRange(first, count, my_vector);
+     return my_vector;
+}
+
+/**
+ * @param   : A minimum item level.
+ * @return  : The number of items whose level is at least the given level.
+ */
+int Inventory::countItemsWithLevelAtLeast(int level) const
+{
+     if (backend_ == FLAT_BACKEND)
+     {
+          return std::count_if(flat_items_.begin(), flat_items_.end(), [level](Item *item)
+                               { return item->getLevel() >= level; });
+     }
+     return countLevelHelper(getRoot(), level);
+}
+
+// Helper Function
+void Inventory::collectItems(std::vector<Item *> &my_vector) const
+{
+     if (backend_ == FLAT_BACKEND)
+     {
+          my_vector = flat_items_;
+          return;
+     }
+     my_vector.reserve(getNumberOfNodes());
+     inorderTraversal(my_vector, getRoot());
+}
+
+// Helper Function
+std::vector<Item *>::const_iterator Inventory::flatLowerBound(Item *target) const
+{
+     return std::lower_bound(flat_items_.begin(), flat_items_.end(), target, [](Item *a, Item *b)
+                             { return a->operator<(*b); });
+}
+
+// Helper Function
+std::vector<Item *>::const_iterator Inventory::flatUpperBound(Item *target) const
+{
+     return std::upper_bound(flat_items_.begin(), flat_items_.end(), target, [](Item *a, Item *b)
+                             { return a->operator<(*b); });
+}
+
+// Helper Function
+int Inventory::countLevelHelper(std::shared_ptr<BinaryNode<Item *>> subtree, int level) const
+{
+     if (subtree == nullptr)
+     {
+          return 0;
+     }
+     int count = (subtree->getItem()->getLevel() >= level) ? 1 : 0;
+     return count + countLevelHelper(subtree->getLeftChildPtr(), level) + countLevelHelper(subtree->getRightChildPtr(), level);
+}
+
 // Helper Function
 void Inventory::printInventoryInOrderDescending(const std::string &attribute)
 {
      std::vector<Item *> my_vector;
-     inorderTraversal(my_vector, getRoot());
+     collectItems(my_vector);
      if (attribute == "NAME")
      {
           std::sort(my_vector.begin(), my_vector.end(), [this](Item *a, Item *b) // use of lambda expression to sort based on name descending
@@ -265,7 +665,7 @@ void Inventory::printInventoryInOrderDescending(const std::string &attribute)
      else if (attribute == "TYPE")
      {
           std::sort(my_vector.begin(), my_vector.end(), [this](Item *a, Item *b) // use of lambda expression to sort based on type descending
-                    { return a->getType() > b->getType(); });
+                    { return typeOrder(a->getItemType()) > typeOrder(b->getItemType()); });
           for (int i = 0; i < my_vector.size(); i++)
           {
                printItemDetails(my_vector[i]);
@@ -304,7 +704,7 @@ void Inventory::printInventoryInOrderDescending(const std::string &attribute)
 void Inventory::printInventoryInOrderAscending(const std::string &attribute)
 {
      std::vector<Item *> my_vector;
-     inorderTraversal(my_vector, getRoot());
+     collectItems(my_vector);
      if (attribute == "NAME")
      {
           std::sort(my_vector.begin(), my_vector.end(), [this](Item *a, Item *b) // use of lambda expression to sort based on name ascending
@@ -317,7 +717,7 @@ void Inventory::printInventoryInOrderAscending(const std::string &attribute)
      else if (attribute == "TYPE")
      {
           std::sort(my_vector.begin(), my_vector.end(), [this](Item *a, Item *b) // use of lambda expression to sort based on type ascending
-                    { return a->getType() < b->getType(); });
+                    { return typeOrder(a->getItemType()) < typeOrder(b->getItemType()); });
           for (int i = 0; i < my_vector.size(); i++)
           {
                printItemDetails(my_vector[i]);
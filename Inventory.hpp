@@ -18,10 +18,73 @@
 #include "BinarySearchTree.hpp"
 #include "BinaryNode.hpp"
 #include "Item.hpp"
+#include "Instrumentation.hpp"
 
-class Inventory : public BinarySearchTree<Item *>
+enum InventoryBackend
+{
+    BST_BACKEND, // items are kept in the inherited BinarySearchTree
+    FLAT_BACKEND // items are kept in a contiguous vector sorted by name
+};
+
+// The tree is a private base: with FLAT_BACKEND it stays empty, so its own queries would not describe the inventory.
+// Use the Inventory methods below, which answer for either backend.
+class Inventory : private BinarySearchTree<Item *>
 {
 public:
+    /**
+    Default Constructor
+    */
+    Inventory();
+
+    /**
+     * @param : The storage the inventory should use.
+     * @post  : Creates an empty inventory with the given backend. BST_BACKEND stores items in the inherited BinarySearchTree.
+                FLAT_BACKEND stores them in a contiguous vector sorted by name, which is faster for small-to-medium inventories
+                (see Benchmark.cpp for the crossover point).
+     */
+    Inventory(InventoryBackend backend);
+
+    /**
+     * @param : A reference to a vector of Item pointers, in any order, and the storage the inventory should use.
+     * @post  : The inventory holds the given items, added with addItems(). With BST_BACKEND the tree is perfectly balanced.
+     */
+    Inventory(const std::vector<Item *> &items, InventoryBackend backend = BST_BACKEND);
+
+    /**
+    @param: a reference to string name of an input file
+    @pre: Formatting of the csv file is as follows:
+        Name: A string
+        Type: An uppercase string [WEAPON, ARMOR, CONSUMABLE, UNKNOWN]
+        Level: A non negative integer
+        Value: A non negative integer
+        Quantity: A positive integer
+    Notes:
+        - The first line of the input file is a header and should be ignored.
+    @post: Each line of the input file corresponds to an Item that is dynamically allocated and added to the inventory with addItems().
+           Items that addItems() does not take are deleted.
+    */
+    Inventory(const std::string &input_file_name, InventoryBackend backend = BST_BACKEND);
+
+    /**
+     * @return : The storage the inventory uses.
+     */
+    InventoryBackend getBackend() const;
+
+    /**
+     * @return : The number of distinct items in the inventory, for either backend.
+     */
+    int getItemCount() const;
+
+    /**
+     * @return : The number of distinct items in the inventory, for either backend (the same as getItemCount()).
+     */
+    int getNumberOfNodes() const;
+
+    /**
+     * @return : True if the inventory holds no items, for either backend.
+     */
+    bool isEmpty() const;
+
     /**
      * @param : A Pointer to the Item object to be added to the inventory.
      * @post  : The Item is added to the inventory, preserving the BST structure. The BST property is based on (ascending) alphabetical order of the item's name.
@@ -31,6 +94,18 @@ public:
     */
     bool addItem(Item *add);
 
+    /**
+     * @param : A reference to a vector of Item pointers, in any order.
+     * @post  : Every item is added as if by addItem(), in the order given: duplicates of UNKNOWN, WEAPON or ARMOR items are ignored,
+                and repeated CONSUMABLE items have their quantities combined into the first instance, updating its time_picked_up_.
+                The incoming items are sorted and merged with the current contents, and the tree is then rebuilt perfectly balanced in O(n),
+                so sorted input no longer produces a degenerate tree.
+                If rejected is given, every item the inventory did not take (an ignored duplicate, or a CONSUMABLE whose
+                quantity went to the first instance) is appended to it, so the caller can delete it.
+     * @return : The number of items that were added to the inventory or updated.
+     */
+    int addItems(const std::vector<Item *> &items, std::vector<Item *> *rejected = nullptr);
+
     /**
      * @param   : A reference to string name of the item to be found.
      * @return  : An Item pointer to the found item, or nullptr if the item is not in the inventory.
@@ -102,12 +177,63 @@ public:
     */
     void printInventory(const bool &print, const std::string &inventory);
 
+    /**
+     * @param   : References to strings naming the low and high ends of the range (inclusive).
+     * @return  : The items whose names fall within [low, high], in ascending order of name.
+     * Only the part of the tree overlapping the range is visited, so this is O(log n + k) for k results.
+     * Example usage: inventory.getItemsInRange("APPLE", "MACE");
+     */
+    std::vector<Item *> getItemsInRange(const std::string &low, const std::string &high) const;
+
+    /**
+     * @param   : References to strings naming the low and high ends of the range (inclusive).
+     * @return  : The number of items whose names fall within [low, high], in O(log n).
+     */
+    int countItemsInRange(const std::string &low, const std::string &high) const;
+
+    /**
+     * @param   : The 0-based position k of an item in ascending order of name.
+     * @return  : A pointer to the k-th item by name, or nullptr if k is out of range.
+     */
+    Item *getItemAt(int k) const;
+
+    /**
+     * @param   : A reference to string name of an item.
+     * @return  : The number of items whose names come before the given name. If the item is
+                  in the inventory, this is its 0-based position in ascending order of name.
+     */
+    int getRankOf(const std::string &name) const;
+
+    /**
+     * @param   : The 0-based position of the first item on the page, and the page size.
+     * @return  : Up to count items in ascending order of name, starting at position first.
+     * Used to page through large inventories without copying the whole tree: O(log n + count).
+     */
+    std::vector<Item *> getItemPage(int first, int count) const;
+
+    /**
+     * @param   : A minimum item level.
+     * @return  : The number of items whose level is at least the given level.
+     * Note: the tree is ordered by name, so every node is visited, but no items are copied.
+     */
+    int countItemsWithLevelAtLeast(int level) const;
+
     // Helper Function
+    ItemType parseItemType(const std::string &type) const;
+    static int typeOrder(ItemType type);
     int goldItem(std::shared_ptr<BinaryNode<Item *>> Gold);
-    void inorderTraversal(std::vector<Item *> &my_vector, std::shared_ptr<BinaryNode<Item *>> name);
+    void inorderTraversal(std::vector<Item *> &my_vector, std::shared_ptr<BinaryNode<Item *>> name) const;
     void printItemDetails(Item *item);
     void printInventoryInOrderDescending(const std::string &attribute);
     void printInventoryInOrderAscending(const std::string &attribute);
+    int countLevelHelper(std::shared_ptr<BinaryNode<Item *>> subtree, int level) const;
+    void collectItems(std::vector<Item *> &my_vector) const;
+    std::vector<Item *>::const_iterator flatLowerBound(Item *target) const;
+    std::vector<Item *>::const_iterator flatUpperBound(Item *target) const;
+
+private:
+    InventoryBackend backend_;       // The storage in use
+    std::vector<Item *> flat_items_; // Items sorted by name, used only with FLAT_BACKEND
 };
 
 #endif
\ No newline at end of file
@@ -8,7 +8,7 @@
 
 /*Constructors */
 
-Item::Item() : type_{UNKNOWN}, name_{"UNKNOWN"}, level_{1}, gold_value_{1}, quantity_{1}
+Item::Item() : type_{UNKNOWN}, name_{NameTable::intern("UNKNOWN")}, level_{1}, gold_value_{1}, quantity_{1}
 {
     updateTimePickedUp();
 }
@@ -31,6 +31,15 @@ Item::Item(const std::string &name, ItemType type, int level, int gold_value, in
     updateTimePickedUp();
 }
 
+/*
+    @param: a name, cleaned as by setName, and the storage for it
+    @post: an UNKNOWN Item used only to look up or order by name, whose name is kept in probe_name instead of being interned
+*/
+Item::Item(const std::string &name, InternedName &probe_name) : name_{&probe_name}, type_{UNKNOWN}, level_{0}, gold_value_{1}, quantity_{1}, time_picked_up_{0}
+{
+    NameTable::makeProbe(cleanName(name), probe_name);
+}
+
 // Getters
 
 /*
@@ -38,6 +47,7 @@ Item::Item(const std::string &name, ItemType type, int level, int gold_value, in
 */
 std::string Item::getType() const
 {
+    RPG_ALLOCATION_SCOPE("Item::getType");
     switch (type_)
     {
     case WEAPON:
@@ -51,12 +61,29 @@ std::string Item::getType() const
     }
 }
 
+/*
+    @return : the ItemType enum value of the Item.
+            : Unlike getType(), no string is built, so prefer this for comparisons.
+*/
+ItemType Item::getItemType() const
+{
+    return type_;
+}
+
 /*
     @return : a string corresponding to the name of the Item
 */
-std::string Item::getName() const
+const std::string &Item::getName() const
 {
-    return name_;
+    return name_->text_;
+}
+
+/*
+    @return : the precomputed hash of the Item's name
+*/
+std::size_t Item::getNameHash() const
+{
+    return name_->hash_;
 }
 
 /*
@@ -117,7 +144,17 @@ void Item::setType(const ItemType &type)
 */
 void Item::setName(const std::string &name)
 {
-    std::string res = "";
+    name_ = NameTable::intern(cleanName(name));
+}
+
+/*
+    @return: the name converted as setName describes. The string is reused by the next call on the same thread.
+*/
+const std::string &Item::cleanName(const std::string &name)
+{
+    // reused between calls, so cleaning a name does not allocate once the buffer has grown
+    static thread_local std::string res;
+    res.clear();
     for (char c : name)
     {
         if (isalpha(c) || c == ' ')
@@ -127,12 +164,9 @@ void Item::setName(const std::string &name)
     }
     if (res.empty())
     {
-        name_ = "UNKNOWN";
-    }
-    else
-    {
-        name_ = res;
+        res = "UNKNOWN";
     }
+    return res;
 }
 
 /*
@@ -210,14 +244,14 @@ void Item::updateTimePickedUp()
 */
 bool Item::operator==(const Item &other) const
 {
-    return this->getName() == other.getName();
+    return NameTable::equal(name_, other.name_);
 }
 /*
    @return: true if the name of this item is lower in alphabetical order than the name of the argument, false otherwise
 */
 bool Item::operator<(const Item &other) const
 {
-    return name_ < other.getName();
+    return NameTable::less(name_, other.name_);
 }
 
 /*
@@ -225,5 +259,5 @@ bool Item::operator<(const Item &other) const
 */
 bool Item::operator>(const Item &other) const
 {
-    return name_ > other.getName();
+    return NameTable::less(other.name_, name_);
 }
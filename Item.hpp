@@ -9,6 +9,8 @@
 #include <string>
 #include <ctime>
 #include <chrono>
+#include "NameTable.hpp"
+#include "AllocationTracker.hpp"
 
 enum ItemType
 {
@@ -33,15 +35,33 @@ public:
     */
     Item(const std::string &name, ItemType type = UNKNOWN, int level = 0, int gold_value = 0, int quantity = 1);
 
+    /*
+    @param: a name, cleaned as by setName, and the storage for it
+    @post: an UNKNOWN Item used only to look up or order by name. Its name is kept in probe_name (see NameTable::makeProbe)
+         : instead of being interned, so looking up names that are not in use never grows the NameTable.
+         : probe_name must outlive the Item.
+    */
+    Item(const std::string &name, InternedName &probe_name);
+
     /*
      @return : a string corresponding to the name of the Item
+             : the string is shared by every Item with the same name
      */
-    std::string getName() const;
+    const std::string &getName() const;
+    /*
+    @return : the precomputed hash of the Item's name
+    */
+    std::size_t getNameHash() const;
     /*
     @return : a string corresponding to the Item type
     */
     std::string getType() const;
     /*
+    @return : the ItemType enum value of the Item.
+            : Unlike getType(), no string is built, so prefer this for comparisons.
+    */
+    ItemType getItemType() const;
+    /*
     @return : an integer indicating the level of the Item
     */
     int getLevel() const;
@@ -99,10 +119,12 @@ public:
 
     /*
    @return: true if the Items have the same name, false otherwise
+          : names are interned, so this is a single pointer comparison unless one of the Items is a lookup probe
     */
     bool operator==(const Item &other) const;
     /*
    @return: true if the name of this item is lower in alphabetical order than the name of the argument, false otherwise
+          : the first 8 characters are compared as one integer; the full names only when those tie
     */
     bool operator<(const Item &other) const;
     /*
@@ -111,7 +133,12 @@ public:
     bool operator>(const Item &other) const;
 
 private:
-    std::string name_;
+    /*
+    @return: the name converted as setName describes. The string is reused by the next call on the same thread.
+    */
+    static const std::string &cleanName(const std::string &name);
+
+    const InternedName *name_; // interned: one copy of each distinct name is shared by all Items
     ItemType type_;
     int level_;
     int gold_value_;
@@ -195,7 +195,7 @@ void Mage::display() const
     If the character is equipped with a wand or staff, they cast a healing ritual and recover vitality points – 2 points with a wand, 3 with a staff.
     If they can summon an incarnate, the emotional support allows the character to recover 1 Vitality point.
 */
-void Mage::eatTaintedStew()
+void Mage::eatTaintedStew(std::mt19937 &)
 {
     int vitality_points = getVitality();
     if (getRace() == "HUMAN" || getRace() == "NONE" || getRace() == "ELF" || getRace() == "DWARF" || getRace() == "LIZARD") // If the Mage character does not have race of "UNDEAD" the vitality is set to 1.
@@ -219,4 +219,12 @@ void Mage::eatTaintedStew()
         vitality_points += 3;
     }
     setVitality(vitality_points);
-}
\ No newline at end of file
+}
+
+/**
+@return: MAGE
+*/
+Subclass Mage::getSubclass() const
+{
+    return MAGE;
+}
@@ -120,7 +120,12 @@ public:
     If the character is equipped with a wand or staff, they cast a healing ritual and recover vitality points – 2 points with a wand, 3 with a staff.
     If they can summon an incarnate, the emotional support allows the character to recover 1 Vitality point.
     */
-    void eatTaintedStew() override;
+    void eatTaintedStew(std::mt19937 &random) override;
+
+    /**
+    @return: MAGE
+    */
+    Subclass getSubclass() const override;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,165 @@
+/*
+ * File Title: MigrationQueue.cpp
+ * Author: Mahim Ali
+ * Date: October 19, 2026
+ * This file implements a class called MigrationQueue
+ */
+#include "MigrationQueue.hpp"
+#include <new>
+
+/** Default Constructor **/
+MigrationQueue::MigrationQueue() : head_{&stub_}, tail_{&stub_}, chunk_count_{0}, free_{0}
+{
+    stub_.next_.store(nullptr, std::memory_order_relaxed);
+    stub_.character_ = nullptr;
+    stub_.from_ = 0;
+    for (std::atomic<Message *> &chunk : chunks_)
+    {
+        chunk.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+/*
+    @post: deletes every message, but not the Characters still in the queue
+*/
+MigrationQueue::~MigrationQueue()
+{
+    for (int chunk = 0; chunk < chunk_count_; chunk++)
+    {
+        delete[] chunks_[chunk].load(std::memory_order_relaxed);
+    }
+}
+
+/*
+    @param: a message
+    @post: links the message in at the head of the queue
+*/
+void MigrationQueue::push(Message *message)
+{
+    message->next_.store(nullptr, std::memory_order_relaxed);
+    Message *previous = head_.exchange(message, std::memory_order_acq_rel);
+    // until this store the message is only reachable from head_, so the receiver stops at previous
+    previous->next_.store(message, std::memory_order_release);
+}
+
+/*
+    @param: a Character that has left its tavern, and the index of that tavern
+    @post: adds the Character to the back of the queue
+*/
+void MigrationQueue::post(Character *character, size_t from)
+{
+    Message *message = takeMessage();
+    message->character_ = character;
+    message->from_ = from;
+    push(message);
+}
+
+/*
+    @param: where to store the Character at the front of the queue and the index of the tavern it came from
+    @return: true if a Character was taken off the queue, false if none is ready
+*/
+bool MigrationQueue::receive(Character *&character, size_t &from)
+{
+    Message *tail = tail_;
+    Message *next = tail->next_.load(std::memory_order_acquire);
+    if (tail == &stub_) // skip the stub
+    {
+        if (next == nullptr)
+        {
+            return false;
+        }
+        tail_ = next;
+        tail = next;
+        next = next->next_.load(std::memory_order_acquire);
+    }
+    if (next == nullptr)
+    {
+        if (tail != head_.load(std::memory_order_acquire))
+        {
+            return false; // a poster has swapped in after tail but not linked it yet
+        }
+        // tail is the only message left: put the stub behind it, so tail can be taken without emptying the queue
+        push(&stub_);
+        next = tail->next_.load(std::memory_order_acquire);
+        if (next == nullptr)
+        {
+            return false;
+        }
+    }
+    tail_ = next;
+    character = tail->character_;
+    from = tail->from_;
+    freeMessages(tail, tail);
+    return true;
+}
+
+/*
+    Helper Function
+    @param: the index of a message
+    @return: the message at that index of the chunks
+*/
+MigrationQueue::Message *MigrationQueue::messageAt(std::uint32_t index) const
+{
+    // chunk k starts at index FIRST_CHUNK * (2^k - 1)
+    int chunk = 31 - __builtin_clz(index / FIRST_CHUNK + 1);
+    return chunks_[chunk].load(std::memory_order_acquire) + (index - FIRST_CHUNK * ((1u << chunk) - 1));
+}
+
+/*
+    Helper Function
+    @return: a message that is in neither the queue nor the free list, taken off the free list,
+             or from a new chunk when the list is empty
+*/
+MigrationQueue::Message *MigrationQueue::takeMessage()
+{
+    while (true)
+    {
+        std::uint64_t head = free_.load(std::memory_order_acquire);
+        while (std::uint32_t(head) != 0)
+        {
+            Message *message = messageAt(std::uint32_t(head) - 1);
+            // if message was taken and given back since head was read, the counter has moved on and the exchange fails
+            std::uint64_t next = ((head >> 32) + 1) << 32 | message->free_next_.load(std::memory_order_relaxed);
+            if (free_.compare_exchange_weak(head, next, std::memory_order_acquire, std::memory_order_acquire))
+            {
+                return message;
+            }
+        }
+        std::lock_guard<std::mutex> lock(grow_mutex_);
+        if (std::uint32_t(free_.load(std::memory_order_acquire)) != 0)
+        {
+            continue; // another poster grew the queue, or the receiver gave messages back, while this one waited
+        }
+        if (chunk_count_ == MAX_CHUNKS)
+        {
+            throw std::bad_alloc();
+        }
+        std::uint32_t size = FIRST_CHUNK << chunk_count_;
+        std::uint32_t first = FIRST_CHUNK * ((1u << chunk_count_) - 1);
+        Message *chunk = new Message[size];
+        for (std::uint32_t i = 0; i < size; i++)
+        {
+            chunk[i].index_ = first + i;
+            chunk[i].free_next_.store(i + 1 < size ? first + i + 2 : 0, std::memory_order_relaxed);
+        }
+        chunks_[chunk_count_++].store(chunk, std::memory_order_release);
+        freeMessages(&chunk[1], &chunk[size - 1]); // the first message is this post's
+        return &chunk[0];
+    }
+}
+
+/*
+    Helper Function
+    @param: the first and last of a run of messages linked by free_next_
+    @post: the run is on top of the free list
+*/
+void MigrationQueue::freeMessages(Message *first, Message *last)
+{
+    std::uint64_t head = free_.load(std::memory_order_relaxed);
+    std::uint64_t next;
+    do
+    {
+        last->free_next_.store(std::uint32_t(head), std::memory_order_relaxed);
+        next = ((head >> 32) + 1) << 32 | (first->index_ + 1);
+    } while (!free_.compare_exchange_weak(head, next, std::memory_order_release, std::memory_order_relaxed));
+}
@@ -0,0 +1,88 @@
+/*
+ * File Title: MigrationQueue.hpp
+ * Author: Mahim Ali
+ * Date: October 19, 2026
+ * This file is the interface of a class called MigrationQueue
+ */
+#ifndef MIGRATION_QUEUE_HPP
+#define MIGRATION_QUEUE_HPP
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include "Character.hpp"
+
+/*
+    The inbox of one tavern: Characters on their way in from other taverns.
+
+    Any number of threads may post at the same time, but only one thread at a time may receive (the one that owns
+    the tavern). It is the intrusive queue of Dmitry Vyukov: post is one atomic exchange and one store, with no
+    locks and no retry loop, and receive never waits for a poster. A message whose poster is between its two steps
+    is not visible yet; it is received by a later call.
+
+    Messages are not allocated one by one: they live in chunks owned by the queue, which double in size as the queue
+    needs more, and a received message goes back on a free list for the next post. The free list is a lock-free stack
+    of message indices whose head carries a counter, so a poster that pops a message another poster has popped and
+    given back in the meantime fails its exchange instead of corrupting the list. Only growing takes a lock.
+*/
+class MigrationQueue
+{
+public:
+    MigrationQueue();
+
+    /*
+    @post: deletes every message, but not the Characters still in the queue
+    */
+    ~MigrationQueue();
+
+    MigrationQueue(const MigrationQueue &) = delete;
+    MigrationQueue &operator=(const MigrationQueue &) = delete;
+
+    /*
+    @param: a Character that has left its tavern, and the index of that tavern
+    @post: adds the Character to the back of the queue. Safe to call from any thread.
+    */
+    void post(Character *character, size_t from);
+
+    /*
+    @param: where to store the Character at the front of the queue and the index of the tavern it came from
+    @return: true if a Character was taken off the queue, false if none is ready.
+             Only one thread at a time may call receive.
+    */
+    bool receive(Character *&character, size_t &from);
+
+private:
+    struct Message
+    {
+        std::atomic<Message *> next_;
+        Character *character_;
+        size_t from_;
+        std::uint32_t index_;                  // position in the chunks, for the free list
+        std::atomic<std::uint32_t> free_next_; // index + 1 of the next free message, 0 for none
+    };
+
+    static const int FIRST_CHUNK = 64; // messages in the first chunk; chunk k holds FIRST_CHUNK << k
+    static const int MAX_CHUNKS = 26;  // enough chunks for 2^32 messages
+
+    std::atomic<Message *> head_; // the message posted last; posters swap themselves in here
+    Message *tail_;               // the next message to receive, owned by the receiver
+    Message stub_;                // a message without a Character, so the queue is never empty of nodes
+
+    std::atomic<Message *> chunks_[MAX_CHUNKS]; // every message of the queue, null past the last chunk
+    int chunk_count_;                           // chunks allocated, guarded by grow_mutex_
+    std::mutex grow_mutex_;                     // held by the one poster that adds a chunk
+    std::atomic<std::uint64_t> free_;           // pops and pushes in the high half, index + 1 of the top message in the low half
+
+    // Helper Function: links a message in at the head of the queue
+    void push(Message *message);
+
+    // Helper Function: the message at an index of the chunks
+    Message *messageAt(std::uint32_t index) const;
+
+    // Helper Function: a free message for post, from the free list or a new chunk
+    Message *takeMessage();
+
+    // Helper Function: puts the linked messages first ... last (by free_next_) on the free list
+    void freeMessages(Message *first, Message *last);
+};
+#endif // MIGRATION_QUEUE_HPP
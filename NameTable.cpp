@@ -0,0 +1,111 @@
+/*
+ * File Title: NameTable.cpp
+ * Author: Mahim Ali
+ * Date: October 19, 2026
+ * This file implements a class called NameTable
+ */
+#include "NameTable.hpp"
+
+/*
+    @param: a reference to a name
+    @return: a pointer to the single InternedName holding the given text
+    @post: the name is added to the table if it was not already there
+*/
+const InternedName *NameTable::intern(const std::string &name)
+{
+    std::lock_guard<std::mutex> lock(tableMutex());
+    auto found = table().find(std::string_view(name));
+    if (found != table().end())
+    {
+        return found->second.get();
+    }
+    std::unique_ptr<InternedName> entry(new InternedName{name, std::hash<std::string>()(name), packPrefix(name)});
+    const InternedName *result = entry.get();
+    // the key views the entry's own text, which never moves
+    table().emplace(std::string_view(entry->text_), std::move(entry));
+    return result;
+}
+
+/*
+    @param: a reference to a name, and the InternedName to fill in
+    @post: probe holds the name as intern would, without the table being searched or changed
+*/
+void NameTable::makeProbe(const std::string &name, InternedName &probe)
+{
+    probe.text_.assign(name);
+    probe.hash_ = std::hash<std::string>()(name);
+    probe.prefix_ = packPrefix(name);
+    probe.interned_ = false;
+}
+
+/*
+    @return: true if lhs and rhs hold the same name
+*/
+bool NameTable::equal(const InternedName *lhs, const InternedName *rhs)
+{
+    if (lhs == rhs)
+    {
+        return true;
+    }
+    if (lhs->interned_ && rhs->interned_) // every interned name has exactly one entry
+    {
+        return false;
+    }
+    return lhs->prefix_ == rhs->prefix_ && lhs->text_ == rhs->text_;
+}
+
+/*
+    @return: true if the name lhs comes before rhs in alphabetical order
+*/
+bool NameTable::less(const InternedName *lhs, const InternedName *rhs)
+{
+    if (lhs == rhs)
+    {
+        return false;
+    }
+    if (lhs->prefix_ != rhs->prefix_)
+    {
+        return lhs->prefix_ < rhs->prefix_;
+    }
+    return lhs->text_ < rhs->text_;
+}
+
+/*
+    @return: the number of distinct names interned so far
+*/
+std::size_t NameTable::size()
+{
+    std::lock_guard<std::mutex> lock(tableMutex());
+    return table().size();
+}
+
+/*
+    @return: the first 8 characters of the text packed big-endian into an integer, padded with zeros
+*/
+unsigned long long NameTable::packPrefix(const std::string &text)
+{
+    unsigned long long prefix = 0;
+    for (std::size_t i = 0; i < 8; i++)
+    {
+        prefix <<= 8;
+        if (i < text.size())
+        {
+            prefix |= static_cast<unsigned char>(text[i]);
+        }
+    }
+    return prefix;
+}
+
+// Helper Function: function-local statics so Items created during static initialization can intern safely
+std::mutex &NameTable::tableMutex()
+{
+    static std::mutex table_mutex;
+    return table_mutex;
+}
+
+// Helper Function
+std::unordered_map<std::string_view, std::unique_ptr<InternedName>> &NameTable::table()
+{
+    static std::unordered_map<std::string_view, std::unique_ptr<InternedName>> names;
+    return names;
+}
@@ -0,0 +1,69 @@
+/*
+ * File Title: NameTable.hpp
+ * Author: Mahim Ali
+ * Date: October 19, 2026
+ * This file is the interface of a class called NameTable
+ */
+#ifndef NAME_TABLE_HPP
+#define NAME_TABLE_HPP
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+
+struct InternedName
+{
+    std::string text_;           // the name itself, stored once for every Item that shares it
+    std::size_t hash_;           // hash of text_, computed once when the name is interned
+    unsigned long long prefix_;  // the first 8 characters packed big-endian, so comparing prefixes orders names alphabetically
+    bool interned_ = true;       // false for a lookup probe (see NameTable::makeProbe), which is not in the table
+};
+
+class NameTable
+{
+public:
+    /*
+    @param: a reference to a name
+    @return: a pointer to the single InternedName holding the given text. The same text always returns the same pointer,
+             so two interned names are equal exactly when their pointers are equal.
+    @post: the name is added to the table if it was not already there. Entries are never removed, so the pointer stays valid
+           for the lifetime of the program.
+    */
+    static const InternedName *intern(const std::string &name);
+
+    /*
+    @param: a reference to a name, and the InternedName to fill in
+    @post: probe holds the name as intern would, but the table is neither searched nor changed (so no lock is taken and
+           the table never grows with names that are only looked up). probe's text reuses its buffer, so a probe kept
+           between lookups does not allocate once it has grown.
+    */
+    static void makeProbe(const std::string &name, InternedName &probe);
+
+    /*
+    @return: true if lhs and rhs hold the same name: a single pointer comparison when both are interned,
+             otherwise the packed prefixes and then the full strings are compared
+    */
+    static bool equal(const InternedName *lhs, const InternedName *rhs);
+
+    /*
+    @return: true if the name lhs comes before rhs in alphabetical order.
+             The packed prefixes are compared first, and the full strings only when the prefixes tie.
+    */
+    static bool less(const InternedName *lhs, const InternedName *rhs);
+
+    /*
+    @return: the number of distinct names interned so far
+    */
+    static std::size_t size();
+
+private:
+    /*
+    @return: the first 8 characters of the text packed big-endian into an integer, padded with zeros
+    */
+    static unsigned long long packPrefix(const std::string &text);
+
+    static std::mutex &tableMutex();
+    static std::unordered_map<std::string_view, std::unique_ptr<InternedName>> &table();
+};
+#endif // NAME_TABLE_HPP
@@ -0,0 +1,69 @@
+/*
+ * File Title: NodePool.cpp
+ * Author: Mahim Ali
+ * Date: October 19, 2026
+ * This file implements a class called NodePool
+ */
+
+// default constructor
+template <class T>
+NodePool<T>::NodePool() : current_slab_{0}, slab_used_{0}, free_list_{nullptr} {}
+
+/**
+   @param item to store in the node
+   @return a node holding item, with no next or previous node */
+template <class T>
+Node<T> *NodePool<T>::acquire(const T &item)
+{
+  Node<T> *node = nullptr;
+  if (free_list_ != nullptr)
+  {
+    node = free_list_;
+    free_list_ = free_list_->getNext();
+  }
+  else
+  {
+    if (slab_used_ == SLAB_SIZE)
+    {
+      current_slab_++;
+      slab_used_ = 0;
+    }
+    if (current_slab_ == slabs_.size())
+    {
+      slabs_.emplace_back(new Node<T>[SLAB_SIZE]);
+    }
+    node = &slabs_[current_slab_][slab_used_++];
+  }
+  node->setItem(item);
+  node->setNext(nullptr);
+  node->setPrevious(nullptr);
+  return node;
+} // end acquire
+
+/**
+   @param node previously returned by acquire
+   @post node is on the free list and will be handed out again by acquire */
+template <class T>
+void NodePool<T>::release(Node<T> *node)
+{
+  node->setItem(T()); // let go of whatever the item holds
+  node->setPrevious(nullptr);
+  node->setNext(free_list_);
+  free_list_ = node;
+} // end release
+
+/**@post every node is free again; the slabs are kept and refilled from the first one */
+template <class T>
+void NodePool<T>::reset()
+{
+  current_slab_ = 0;
+  slab_used_ = 0;
+  free_list_ = nullptr;
+} // end reset
+
+/**@return the number of nodes the slabs can hold */
+template <class T>
+size_t NodePool<T>::getCapacity() const
+{
+  return slabs_.size() * SLAB_SIZE;
+} // end getCapacity
@@ -0,0 +1,50 @@
+/*
+ * File Title: NodePool.hpp
+ * Author: Mahim Ali
+ * Date: October 19, 2026
+ * This file is the interface of a class called NodePool
+ */
+#ifndef NODE_POOL_HPP_
+#define NODE_POOL_HPP_
+#include <memory>
+#include <vector>
+#include "Node.hpp"
+
+// Hands out Nodes from contiguous slabs instead of one heap allocation per node.
+// Released nodes go on a free list threaded through their next pointers and are reused first.
+template <class T>
+class NodePool
+{
+public:
+   NodePool(); // default constructor
+
+   // a pool owns its slabs, so it cannot be copied
+   NodePool(const NodePool<T> &) = delete;
+   NodePool<T> &operator=(const NodePool<T> &) = delete;
+
+   /**
+      @param item to store in the node
+      @return a node holding item, with no next or previous node */
+   Node<T> *acquire(const T &item);
+
+   /**
+      @param node previously returned by acquire
+      @post node is on the free list and will be handed out again by acquire */
+   void release(Node<T> *node);
+
+   /**@post every node is free again; the slabs are kept and refilled from the first one */
+   void reset();
+
+   /**@return the number of nodes the slabs can hold */
+   size_t getCapacity() const;
+
+private:
+   static const size_t SLAB_SIZE = 64;           // nodes per slab
+   std::vector<std::unique_ptr<Node<T>[]>> slabs_; // every slab allocated so far
+   size_t current_slab_;                          // slab fresh nodes are taken from
+   size_t slab_used_;                             // nodes already taken from the current slab
+   Node<T> *free_list_;                           // released nodes, linked through next_
+}; // end NodePool
+
+#include "NodePool.cpp"
+#endif // NODE_POOL_HPP_
@@ -0,0 +1,287 @@
+/*
+ * File Title: QuestGraph.cpp
+ * Author: Mahim Ali
+ * Date: October 19, 2026
+ * This file implements a class called QuestGraph
+ */
+#include "QuestGraph.hpp"
+#include <algorithm>
+#include "QuestList.hpp"
+
+/*
+    Default Constructor
+    @post: An empty graph
+*/
+QuestGraph::QuestGraph() : dependency_offsets_{0}, dependent_offsets_{0}, subquest_offsets_{0}, parent_offsets_{0}, visit_stamp_{0}
+{
+}
+
+/*
+    @param: The quests, in id order
+    @post: Compiles the edges of the quests, in both directions, and computes a topological order of the dependencies
+*/
+void QuestGraph::build(const std::vector<Quest *> &quests)
+{
+    int count = quests.size();
+    quests_ = quests;
+    ids_.clear();
+    ids_.reserve(count);
+    for (int id = 0; id < count; id++)
+    {
+        ids_.emplace(quests[id], id); // keeps the first id of a quest listed twice
+    }
+
+    dependency_offsets_.assign(1, 0);
+    dependencies_.clear();
+    subquest_offsets_.assign(1, 0);
+    subquests_.clear();
+    for (int id = 0; id < count; id++)
+    {
+        for (Quest *dependency : quests[id]->dependencies_)
+        {
+            int target = getId(dependency);
+            if (target != -1)
+            {
+                dependencies_.push_back(target);
+            }
+        }
+        dependency_offsets_.push_back(dependencies_.size());
+        for (Quest *subquest : quests[id]->subquests_)
+        {
+            int target = getId(subquest);
+            if (target != -1)
+            {
+                subquests_.push_back(target);
+            }
+        }
+        subquest_offsets_.push_back(subquests_.size());
+    }
+
+    reverseEdges(dependency_offsets_, dependencies_, dependent_offsets_, dependents_);
+    reverseEdges(subquest_offsets_, subquests_, parent_offsets_, parents_);
+
+    // Kahn's algorithm: a quest joins the order once all of its dependencies have
+    topological_order_.clear();
+    topological_order_.reserve(count);
+    std::vector<int> unmet(count);
+    for (int id = 0; id < count; id++)
+    {
+        unmet[id] = dependency_offsets_[id + 1] - dependency_offsets_[id];
+        if (unmet[id] == 0)
+        {
+            topological_order_.push_back(id);
+        }
+    }
+    for (size_t i = 0; i < topological_order_.size(); i++)
+    {
+        int id = topological_order_[i];
+        for (const int *dependent = dependentsBegin(id); dependent != dependentsEnd(id); dependent++)
+        {
+            if (--unmet[*dependent] == 0)
+            {
+                topological_order_.push_back(*dependent);
+            }
+        }
+    }
+    topological_position_.assign(count, -1);
+    for (size_t i = 0; i < topological_order_.size(); i++)
+    {
+        topological_position_[topological_order_[i]] = i;
+    }
+
+    visited_.assign(count, 0);
+    unmet_in_plan_.assign(count, 0);
+    visit_stamp_ = 0;
+}
+
+/*
+    @return: The number of quests in the graph
+*/
+int QuestGraph::getQuestCount() const
+{
+    return quests_.size();
+}
+
+/*
+    @param: A quest pointer
+    @return: The id of the quest, -1 if it is not in the graph
+*/
+int QuestGraph::getId(const Quest *quest) const
+{
+    auto found = ids_.find(quest);
+    return found == ids_.end() ? -1 : found->second;
+}
+
+/*
+    @param: A quest id
+    @return: The quest with that id
+*/
+Quest *QuestGraph::getQuest(int id) const
+{
+    return quests_[id];
+}
+
+/*
+    @param: A quest id
+    @return: The bounds of the quest's row of dependencies, subquests, dependents or parents
+*/
+const int *QuestGraph::dependenciesBegin(int id) const
+{
+    return dependencies_.data() + dependency_offsets_[id];
+}
+
+const int *QuestGraph::dependenciesEnd(int id) const
+{
+    return dependencies_.data() + dependency_offsets_[id + 1];
+}
+
+const int *QuestGraph::subquestsBegin(int id) const
+{
+    return subquests_.data() + subquest_offsets_[id];
+}
+
+const int *QuestGraph::subquestsEnd(int id) const
+{
+    return subquests_.data() + subquest_offsets_[id + 1];
+}
+
+const int *QuestGraph::dependentsBegin(int id) const
+{
+    return dependents_.data() + dependent_offsets_[id];
+}
+
+const int *QuestGraph::dependentsEnd(int id) const
+{
+    return dependents_.data() + dependent_offsets_[id + 1];
+}
+
+const int *QuestGraph::parentsBegin(int id) const
+{
+    return parents_.data() + parent_offsets_[id];
+}
+
+const int *QuestGraph::parentsEnd(int id) const
+{
+    return parents_.data() + parent_offsets_[id + 1];
+}
+
+/*
+    @return: Every quest id that is not on or behind a dependency cycle, each after all of its dependencies
+*/
+const std::vector<int> &QuestGraph::getTopologicalOrder() const
+{
+    return topological_order_;
+}
+
+/*
+    @param: A quest id
+    @return: The quest's index in the topological order, -1 if it is on or depends on a dependency cycle
+*/
+int QuestGraph::getTopologicalPosition(int id) const
+{
+    return topological_position_[id];
+}
+
+/*
+    @return: True if some quests depend on themselves through a chain of dependencies
+*/
+bool QuestGraph::hasCycle() const
+{
+    return topological_order_.size() < quests_.size();
+}
+
+/*
+    Helper Function
+    @param: The CSR rows of some edges, and the rows to fill with the same edges reversed
+    @post: reversed_targets[reversed_offsets[id]] .. holds every id with an edge to id, in increasing order
+*/
+void QuestGraph::reverseEdges(const std::vector<int> &offsets, const std::vector<int> &targets,
+                              std::vector<int> &reversed_offsets, std::vector<int> &reversed_targets)
+{
+    int count = offsets.size() - 1;
+    // count the edges into each quest, then place every edge in its row
+    reversed_offsets.assign(count + 1, 0);
+    for (int target : targets)
+    {
+        reversed_offsets[target + 1]++;
+    }
+    for (int id = 0; id < count; id++)
+    {
+        reversed_offsets[id + 1] += reversed_offsets[id];
+    }
+    reversed_targets.assign(targets.size(), 0);
+    std::vector<int> next(reversed_offsets.begin(), reversed_offsets.end() - 1);
+    for (int id = 0; id < count; id++)
+    {
+        for (int e = offsets[id]; e < offsets[id + 1]; e++)
+        {
+            reversed_targets[next[targets[e]]++] = id;
+        }
+    }
+}
+
+/*
+    @param: A quest id, and a vector to fill
+    @post: plan holds the quest and every incomplete quest it transitively depends on through incomplete quests,
+           each once, in topological order
+    @return: False (and plan is empty) if those quests contain a dependency cycle
+*/
+bool QuestGraph::prerequisitesOf(int id, std::vector<int> &plan) const
+{
+    plan.clear();
+    if (++visit_stamp_ == 0)
+    {
+        // the stamp wrapped around: forget every old visit
+        std::fill(visited_.begin(), visited_.end(), 0);
+        visit_stamp_ = 1;
+    }
+    visited_[id] = visit_stamp_;
+    plan.push_back(id);
+    // plan doubles as the work list: every quest in it still has its dependencies to visit
+    for (size_t i = 0; i < plan.size(); i++)
+    {
+        int current = plan[i];
+        for (const int *dependency = dependenciesBegin(current); dependency != dependenciesEnd(current); dependency++)
+        {
+            if (visited_[*dependency] != visit_stamp_ && !quests_[*dependency]->completed_)
+            {
+                visited_[*dependency] = visit_stamp_;
+                plan.push_back(*dependency);
+            }
+        }
+    }
+
+    // Kahn's algorithm on the plan alone: a cycle that only passes through completed quests,
+    // or that the plan merely sits downstream of, does not stop it
+    std::vector<int> order;
+    order.reserve(plan.size());
+    for (int quest : plan)
+    {
+        unmet_in_plan_[quest] = 0;
+        for (const int *dependency = dependenciesBegin(quest); dependency != dependenciesEnd(quest); dependency++)
+        {
+            unmet_in_plan_[quest] += (visited_[*dependency] == visit_stamp_);
+        }
+        if (unmet_in_plan_[quest] == 0)
+        {
+            order.push_back(quest);
+        }
+    }
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        for (const int *dependent = dependentsBegin(order[i]); dependent != dependentsEnd(order[i]); dependent++)
+        {
+            if (visited_[*dependent] == visit_stamp_ && --unmet_in_plan_[*dependent] == 0)
+            {
+                order.push_back(*dependent);
+            }
+        }
+    }
+    if (order.size() < plan.size()) // the rest of the plan waits on itself
+    {
+        plan.clear();
+        return false;
+    }
+    plan.swap(order);
+    return true;
+}
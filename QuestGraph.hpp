@@ -0,0 +1,116 @@
+/*
+ * File Title: QuestGraph.hpp
+ * Author: Mahim Ali
+ * Date: October 19, 2026
+ * This file is the interface of a class called QuestGraph
+ */
+#ifndef QUEST_GRAPH_HPP
+#define QUEST_GRAPH_HPP
+#include <vector>
+#include <unordered_map>
+
+struct Quest;
+
+/*
+    A compiled, read-only view of the dependency and subquest edges between a set of quests.
+    Every quest gets a dense id (its index in the vector the graph was built from), and the edges are stored
+    in compressed sparse row form: the edges of quest id are targets[offsets[id]] .. targets[offsets[id + 1]].
+    The graph does not own the quests, and reads completion status from them live.
+*/
+class QuestGraph
+{
+public:
+    /*
+    Default Constructor
+    @post: An empty graph
+    */
+    QuestGraph();
+
+    /*
+    @param: The quests, in id order
+    @post: Compiles the dependency, dependent (reverse dependency), subquest and parent (reverse subquest) edges of the quests, and computes a
+           topological order of the dependencies with Kahn's algorithm. Edges to quests that are not in the vector are skipped.
+           O(quests + edges).
+    */
+    void build(const std::vector<Quest *> &quests);
+
+    /*
+    @return: The number of quests in the graph
+    */
+    int getQuestCount() const;
+
+    /*
+    @param: A quest pointer
+    @return: The id of the quest, -1 if it is not in the graph
+    */
+    int getId(const Quest *quest) const;
+
+    /*
+    @param: A quest id
+    @return: The quest with that id
+    */
+    Quest *getQuest(int id) const;
+
+    /*
+    @param: A quest id
+    @return: Pointers to the first and one past the last id of the quest's dependencies, subquests,
+             dependents (the quests that depend on it) or parents (the quests it is a subquest of)
+    */
+    const int *dependenciesBegin(int id) const;
+    const int *dependenciesEnd(int id) const;
+    const int *subquestsBegin(int id) const;
+    const int *subquestsEnd(int id) const;
+    const int *dependentsBegin(int id) const;
+    const int *dependentsEnd(int id) const;
+    const int *parentsBegin(int id) const;
+    const int *parentsEnd(int id) const;
+
+    /*
+    @return: Every quest id that is not on or behind a dependency cycle, each after all of its dependencies
+    */
+    const std::vector<int> &getTopologicalOrder() const;
+
+    /*
+    @param: A quest id
+    @return: The quest's index in the topological order, -1 if it is on or depends on a dependency cycle
+    */
+    int getTopologicalPosition(int id) const;
+
+    /*
+    @return: True if some quests depend on themselves through a chain of dependencies
+    */
+    bool hasCycle() const;
+
+    /*
+    @param: A quest id, and a vector to fill
+    @post: plan holds the quest and every incomplete quest it transitively depends on through incomplete quests,
+           each once, in topological order (so every quest comes after its dependencies and the given quest is last).
+           The order comes from Kahn's algorithm run on the plan's quests alone. O(size of the plan and its edges).
+    @return: False (and plan is empty) if those quests contain a dependency cycle. Cycles elsewhere in the graph,
+             such as one through a completed dependency, do not matter.
+    */
+    bool prerequisitesOf(int id, std::vector<int> &plan) const;
+
+private:
+    static void reverseEdges(const std::vector<int> &offsets, const std::vector<int> &targets,
+                             std::vector<int> &reversed_offsets, std::vector<int> &reversed_targets);
+
+    std::vector<Quest *> quests_;                      // quests by id
+    std::unordered_map<const Quest *, int> ids_;       // id of every quest
+    std::vector<int> dependency_offsets_;              // CSR rows of dependencies_
+    std::vector<int> dependencies_;
+    std::vector<int> dependent_offsets_;               // CSR rows of dependents_
+    std::vector<int> dependents_;
+    std::vector<int> subquest_offsets_;                // CSR rows of subquests_
+    std::vector<int> subquests_;
+    std::vector<int> parent_offsets_;                  // CSR rows of parents_
+    std::vector<int> parents_;
+    std::vector<int> topological_order_;               // ids, dependencies first
+    std::vector<int> topological_position_;            // index of each id in topological_order_, or -1
+
+    // scratch space for prerequisitesOf: a quest has been visited when its stamp equals visit_stamp_
+    mutable std::vector<unsigned> visited_;
+    mutable unsigned visit_stamp_;
+    mutable std::vector<int> unmet_in_plan_; // dependencies of each quest in the plan that are also in it and not yet ordered
+};
+#endif // QUEST_GRAPH_HPP
@@ -9,10 +9,19 @@
 /**
     Default Constructor
 */
-QuestList::QuestList() : DoublyLinkedList<Quest *>()
+QuestList::QuestList() : DoublyLinkedList<Quest *>(), load_stats_{}, graph_dirty_{true}, status_tracked_{true}
 {
 }
 
+/**
+    Copy Constructor
+    @post: The new list holds the same quest pointers, and its own title index.
+*/
+QuestList::QuestList(const QuestList &a_list) : DoublyLinkedList<Quest *>(a_list), load_stats_{a_list.load_stats_}, graph_dirty_{true}, status_tracked_{true}
+{
+    rebuildIndex();
+}
+
 /**
     @param: a reference to string name of an input file
     @pre: Formatting of the csv file is as follows:
@@ -34,95 +43,188 @@ QuestList::QuestList() : DoublyLinkedList<Quest *>()
             - Dependencies: An empty vector
             - Subquests: An empty vector
         - However, if you eventually encounter a quest that matches one of the "NOT DISCOVERED" quests while parsing the file, you should update all the quest details.
-        Hint: update as needed using addQuest()
-
+    The file is loaded in two passes: the first splits every row and gives each distinct title a dense id, the second creates the quests
+    and resolves dependencies and subquests by id. Loading is O(rows + dependencies + subquests); see getLoadStats().
 
     @post: Each line of the input file corresponds to a quest to be added to the list. No duplicates are allowed.
+           Quests appear in the order their titles are first mentioned in the file.
+*/
+QuestList::QuestList(const std::string &input_file_name) : DoublyLinkedList<Quest *>(), load_stats_{}, graph_dirty_{true}, status_tracked_{true}
+{
+    auto start = std::chrono::steady_clock::now();
+    std::string buffer = readQuestFile(input_file_name);
+
+    // Pass 1: split every row into fields and give each distinct title a dense id.
+    std::vector<QuestRow> rows;
+    std::vector<std::string_view> titles; // id -> title
+    std::vector<int> edges;               // dependency and subquest ids of every row, back to back
+    splitQuestRows(buffer, rows, titles, edges);
+
+    // Pass 2: create every quest as "NOT DISCOVERED", then fill in the details of the ones that have a row.
+    std::vector<Quest *> quests(titles.size());
+    for (size_t id = 0; id < titles.size(); id++)
+    {
+        quests[id] = new Quest(std::string(titles[id]), "NOT DISCOVERED", false, 0, {}, {});
+    }
+    std::vector<bool> discovered(titles.size(), false);
+    for (size_t r = 0; r < rows.size(); r++)
+    {
+        Quest *quest = quests[rows[r].id_];
+        if (!discovered[rows[r].id_])
+        {
+            // the first row for a title sets its details; a repeated row only replaces its dependencies and subquests
+            discovered[rows[r].id_] = true;
+            quest->description_ = std::string(rows[r].description_);
+            quest->completed_ = rows[r].completed_;
+            quest->experience_points_ = rows[r].experience_points_;
+        }
+        quest->dependencies_.clear();
+        for (size_t e = rows[r].dependencies_.first; e < rows[r].dependencies_.second; e++)
+        {
+            quest->dependencies_.push_back(quests[edges[e]]);
+        }
+        quest->subquests_.clear();
+        for (size_t e = rows[r].subquests_.first; e < rows[r].subquests_.second; e++)
+        {
+            quest->subquests_.push_back(quests[edges[e]]);
+        }
+    }
+    title_index_.reserve(quests.size());
+    for (size_t id = 0; id < quests.size(); id++)
+    {
+        insert(item_count_, quests[id]);
+    }
+
+    load_stats_.rows_ = rows.size();
+    load_stats_.bytes_ = buffer.size();
+    load_stats_.quests_ = quests.size();
+    load_stats_.edges_ = edges.size();
+    load_stats_.seconds_ = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+    @return: Statistics about the file this list was loaded from: rows, bytes, quests, edges and the time taken.
+             All zero if the list was not loaded from a file.
+*/
+QuestLoadStats QuestList::getLoadStats() const
+{
+    return load_stats_;
+}
+
+/**
+    Helper Function
+    @param: a reference to string name of an input file
+    @return: the whole file, read with one call
+    @post: prints an error and exits if the file cannot be opened
 */
-QuestList::QuestList(const std::string &input_file_name) : DoublyLinkedList<Quest *>()
+std::string QuestList::readQuestFile(const std::string &input_file_name)
 {
-    std::string junk, line, title, description, completion_status_str, experience_points_str, dependencies, subquests, current_dependencies_str, current_subquests_str;
-    Quest *current_dependencies;
-    Quest *current_subquests;
-    bool completion_status;
-    int experience_points;
-    std::vector<Quest *> dependencies_vector;
-    std::vector<Quest *> subquests_vector;
-    std::ifstream fin(input_file_name); // opens the input file
-    if (fin.fail())                     // error message if input file doesn't open
+    std::ifstream fin(input_file_name, std::ios::binary); // opens the input file
+    if (fin.fail())                                       // error message if input file doesn't open
     {
         std::cerr << "File cannot be opened for reading." << std::endl;
         exit(1);
     }
-    getline(fin, junk);
-    while (getline(fin, line))
-    {
-        std::istringstream quest(line);
-        getline(quest, title, ',');
-        getline(quest, description, ',');
-        getline(quest, completion_status_str, ',');
-        completion_status = std::stoi(completion_status_str);
-        getline(quest, experience_points_str, ',');
-        experience_points = std::stoi(experience_points_str);
-        getline(quest, dependencies, ',');
-        std::istringstream dependencies_name(dependencies);
-        if ((dependencies.find("NONE") == -1))
-        {
-            while (getline(dependencies_name, dependencies, ';'))
-            {
-                Quest *newQuest;
-                if (contains(dependencies))
-                {
-                    newQuest = getItem((getPosOf(dependencies)));
-                }
-                else
-                {
-                    newQuest = new Quest(title, description = "NOT DISCOVERED", completion_status = false, experience_points = 0, dependencies_vector = {}, subquests_vector = {});
-                    insert(item_count_, newQuest);
-                }
-                this->addQuest(newQuest);
-                dependencies_vector.push_back(newQuest);
-            }
+    std::string buffer;
+    fin.seekg(0, std::ios::end);
+    buffer.resize(static_cast<size_t>(fin.tellg()));
+    fin.seekg(0, std::ios::beg);
+    fin.read(&buffer[0], buffer.size());
+    fin.close();
+    return buffer;
+}
+
+/**
+    Helper Function
+    @param: the text of a quest csv file, and the vectors to fill
+    @post: rows holds one QuestRow per line after the header, titles holds every distinct title by id, and edges holds
+           the dependency and subquest ids of every row back to back. Every string_view points into buffer.
+*/
+void QuestList::splitQuestRows(const std::string &buffer, std::vector<QuestRow> &rows, std::vector<std::string_view> &titles, std::vector<int> &edges)
+{
+    // Ids are handed out in the order titles are first seen (dependencies, then subquests, then the row's own title),
+    // which is the order the quests end up in the list.
+    std::unordered_map<std::string_view, int> ids; // title -> id
+    auto idOf = [&](std::string_view title)
+    {
+        auto found = ids.emplace(title, static_cast<int>(titles.size()));
+        if (found.second)
+        {
+            titles.push_back(title);
         }
-        getline(quest, subquests, ',');
-        std::istringstream subquests_name(subquests);
-        if ((subquests.find("NONE") == -1))
+        return found.first->second;
+    };
+    std::string_view text(buffer);
+    nextField(text, '\n'); // ignores header line of the csv file.
+    while (!text.empty())
+    {
+        std::string_view line = nextField(text, '\n');
+        if (!line.empty() && line.back() == '\r')
         {
-            while (getline(subquests_name, subquests, ';'))
-            {
-                Quest *newSubquest;
-                if (contains(subquests))
-                {
-                    newSubquest = getItem((getPosOf(subquests)));
-                }
-                else
-                {
-                    newSubquest = new Quest(title, description = "NOT DISCOVERED", completion_status = false, experience_points = 0, dependencies_vector = {}, subquests_vector = {});
-                    insert(item_count_, newSubquest);
-                }
-                this->addQuest(newSubquest);
-                subquests_vector.push_back(newSubquest);
-            }
+            line.remove_suffix(1);
         }
-        if (!contains(title))
+        if (line.empty())
         {
-            Quest *newQuest = new Quest(title, description, completion_status, experience_points, dependencies_vector, subquests_vector);
-            insert(item_count_, newQuest);
+            continue;
         }
-        else
+        QuestRow row;
+        std::string_view title = nextField(line, ',');
+        row.description_ = nextField(line, ',');
+        row.completed_ = parseNumber(nextField(line, ',')) != 0;
+        row.experience_points_ = parseNumber(nextField(line, ','));
+        std::string_view lists[2] = {nextField(line, ','), nextField(line, ',')};
+        for (int list = 0; list < 2; list++)
         {
-            Quest *updateQuest = getItem(getPosOf(title));
-            if (updateQuest->description_ == "NOT DISCOVERED")
+            size_t first_edge = edges.size();
+            if (lists[list] != "NONE")
+            {
+                while (!lists[list].empty())
+                {
+                    std::string_view name = nextField(lists[list], ';');
+                    if (!name.empty())
+                    {
+                        edges.push_back(idOf(name));
+                    }
+                }
+            }
+            if (list == 0)
+            {
+                row.dependencies_ = {first_edge, edges.size()};
+            }
+            else
             {
-                updateQuest->description_ = description;
-                updateQuest->completed_ = completion_status;
-                updateQuest->experience_points_ = experience_points;
+                row.subquests_ = {first_edge, edges.size()};
             }
-            updateQuest->dependencies_ = dependencies_vector;
-            updateQuest->subquests_ = subquests_vector;
         }
+        row.id_ = idOf(title);
+        rows.push_back(row);
     }
-    fin.close();
+}
+
+/**
+    Helper Function
+    @param: A reference to the text still to be split, and the delimiter
+    @return: The text up to the first delimiter (or all of it)
+    @post: The returned field and its delimiter are removed from the front of the text
+*/
+std::string_view QuestList::nextField(std::string_view &text, char delimiter)
+{
+    size_t end = text.find(delimiter);
+    std::string_view field = text.substr(0, end);
+    text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
+    return field;
+}
+
+/**
+    Helper Function
+    @param: A field holding a non negative integer
+    @return: The integer, or 0 if the field does not start with a number
+*/
+int QuestList::parseNumber(std::string_view field)
+{
+    int value = 0;
+    std::from_chars(field.data(), field.data() + field.size(), value);
+    return value;
 }
 
 /**
@@ -131,18 +233,12 @@ QuestList::QuestList(const std::string &input_file_name) : DoublyLinkedList<Ques
 */
 int QuestList::getPosOf(const std::string &quest_title) const
 {
-    Node<Quest *> *head = first_;
-    int pos = 0;
-    while (head != nullptr)
+    auto found = title_index_.find(quest_title);
+    if (found == title_index_.end())
     {
-        if (head->getItem()->title_ == quest_title)
-        {
-            return pos;
-        }
-        head = head->getNext();
-        pos++;
+        return -1;
     }
-    return -1;
+    return found->second.position_;
 }
 
 /**
@@ -151,18 +247,142 @@ int QuestList::getPosOf(const std::string &quest_title) const
 */
 bool QuestList::contains(const std::string &quest_title) const
 {
-    Node<Quest *> *head = first_;
-    bool found = false;
-    while (head != nullptr)
+    return title_index_.find(quest_title) != title_index_.end();
+}
+
+/**
+    @param: A string reference to a quest title
+    @return: A pointer to the first quest in the list with the given title, nullptr if not found.
+*/
+Quest *QuestList::findQuest(const std::string &quest_title) const
+{
+    auto found = title_index_.find(quest_title);
+    if (found == title_index_.end())
     {
-        if (head->getItem()->title_ == quest_title)
+        return nullptr;
+    }
+    return found->second.node_->getItem();
+}
+
+/**
+    @param: The position of insertion and a quest pointer
+    @post: Inserts the quest like DoublyLinkedList::insert, and records it in the title index.
+    @return: true always
+*/
+bool QuestList::insert(size_t position, Quest *const &new_element)
+{
+    graph_dirty_ = true;
+    if (position >= item_count_)
+    {
+        // appending: no other positions change
+        Node<Quest *> *new_node = insertNode(position, new_element);
+        title_index_.emplace(new_element->title_, IndexEntry{new_node, item_count_ - 1});
+        return true;
+    }
+    Node<Quest *> *new_node = insertNode(position, new_element);
+    // every node after the new one moved back by one
+    size_t pos = position + 1;
+    for (Node<Quest *> *curr = new_node->getNext(); curr != nullptr; curr = curr->getNext(), pos++)
+    {
+        auto entry = title_index_.find(curr->getItem()->title_);
+        if (entry->second.node_ == curr)
         {
-            found = true;
-            break;
+            entry->second.position_ = pos;
         }
-        head = head->getNext();
     }
-    return found;
+    auto entry = title_index_.find(new_element->title_);
+    if (entry == title_index_.end())
+    {
+        title_index_.emplace(new_element->title_, IndexEntry{new_node, position});
+    }
+    else if (entry->second.position_ > position)
+    {
+        entry->second = IndexEntry{new_node, position}; // now the first quest with this title
+    }
+    return true;
+}
+
+/**
+    @param: The position of deletion
+    @post: Removes the node like DoublyLinkedList::remove, and keeps the title index in sync.
+    @return: true if there is a node at position to be deleted, false otherwise
+*/
+bool QuestList::remove(size_t position)
+{
+    Node<Quest *> *removed = getPointerTo(position);
+    if (removed == nullptr)
+    {
+        return false;
+    }
+    graph_dirty_ = true;
+    std::string title = removed->getItem()->title_;
+    Node<Quest *> *next = removed->getNext();
+    DoublyLinkedList<Quest *>::remove(position);
+
+    // every node after the removed one moved forward by one
+    size_t pos = position;
+    for (Node<Quest *> *curr = next; curr != nullptr; curr = curr->getNext(), pos++)
+    {
+        auto entry = title_index_.find(curr->getItem()->title_);
+        if (entry->second.node_ == curr)
+        {
+            entry->second.position_ = pos;
+        }
+    }
+    auto entry = title_index_.find(title);
+    if (entry->second.node_ == removed)
+    {
+        // the index pointed at the removed node: fall back to a later quest with the same title, if any
+        title_index_.erase(entry);
+        pos = position;
+        for (Node<Quest *> *curr = next; curr != nullptr; curr = curr->getNext(), pos++)
+        {
+            if (curr->getItem()->title_ == title)
+            {
+                title_index_.emplace(title, IndexEntry{curr, pos});
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+    @post: The list and the title index are empty
+*/
+void QuestList::clear()
+{
+    DoublyLinkedList<Quest *>::clear();
+    title_index_.clear();
+    graph_dirty_ = true;
+}
+
+void QuestList::swapNode(int i, int j)
+{
+    DoublyLinkedList<Quest *>::swapNode(i, j);
+    rebuildIndex();
+    graph_dirty_ = true;
+}
+
+void QuestList::swap(int i, int j)
+{
+    DoublyLinkedList<Quest *>::swap(i, j);
+    rebuildIndex();
+    graph_dirty_ = true;
+}
+
+/**
+    @post: The title index maps every title in the list to the first node holding it
+*/
+void QuestList::rebuildIndex()
+{
+    title_index_.clear();
+    title_index_.reserve(item_count_);
+    size_t pos = 0;
+    for (Node<Quest *> *curr = first_; curr != nullptr; curr = curr->getNext(), pos++)
+    {
+        title_index_.emplace(curr->getItem()->title_, IndexEntry{curr, pos});
+    }
 }
 
 /**
@@ -175,6 +395,7 @@ bool QuestList::contains(const std::string &quest_title) const
 */
 bool QuestList::addQuest(Quest *quest_object)
 {
+    RPG_TIME_SCOPE("QuestList::addQuest");
     if (!contains(quest_object->title_))
     {
         for (int i = 0; i < quest_object->dependencies_.size(); i++)
@@ -194,14 +415,16 @@ bool QuestList::addQuest(Quest *quest_object)
         insert(item_count_, quest_object);
         return true;
     }
-    else if (contains(quest_object->title_) && quest_object->description_ == "NOT DISCOVERED")
+    else if (quest_object->description_ == "NOT DISCOVERED")
     {
-        Quest *existingQuest = getItem(getPosOf(quest_object->title_));
+        Quest *existingQuest = findQuest(quest_object->title_);
         existingQuest->description_ = quest_object->description_;
         existingQuest->completed_ = quest_object->completed_;
         existingQuest->experience_points_ = quest_object->experience_points_;
         existingQuest->dependencies_ = quest_object->dependencies_;
         existingQuest->subquests_ = quest_object->subquests_;
+        RPG_COUNT("QuestList::addQuest undiscovered update");
+        graph_dirty_ = true;
         return true;
     }
     return false;
@@ -223,14 +446,17 @@ bool QuestList::addQuest(Quest *quest_object)
 */
 bool QuestList::addQuest(const std::string &quest_title, const std::string &quest_description, const bool &quest_completed, const int &quest_experience_points, const std::vector<Quest *> &quest_dependencies, const std::vector<Quest *> &quest_subquests)
 {
-    if (contains(quest_title) && quest_description == "NOT DISCOVERED")
+    RPG_TIME_SCOPE("QuestList::addQuest");
+    Quest *existingQuest = findQuest(quest_title);
+    if (existingQuest != nullptr && quest_description == "NOT DISCOVERED")
     {
-        Quest *existingQuest = getItem(getPosOf(quest_title));
         existingQuest->description_ = quest_description;
         existingQuest->completed_ = quest_completed;
         existingQuest->experience_points_ = quest_experience_points;
         existingQuest->dependencies_ = quest_dependencies;
         existingQuest->subquests_ = quest_subquests;
+        RPG_COUNT("QuestList::addQuest undiscovered update");
+        graph_dirty_ = true;
         for (int i = 0; i < existingQuest->dependencies_.size(); i++)
         {
             if (!contains(existingQuest->dependencies_[i]->title_))
@@ -343,15 +569,14 @@ void QuestList::printQuest(Quest *quest_object)
 */
 void QuestList::questQuery(const std::string &quest_title)
 {
-    int questPos = getPosOf(quest_title);
+    Quest *quest = findQuest(quest_title);
     std::cout << "Query: " << quest_title << std::endl;
-    if (questPos == -1)
+    if (quest == nullptr)
     {
 
         std::cout << "No such quest.\n";
         return;
     }
-    Quest *quest = getPointerTo(questPos)->getItem();
     if (quest->completed_)
     {
 
@@ -363,6 +588,585 @@ void QuestList::questQuery(const std::string &quest_title)
     }
 }
 
+/**
+    @param: A string reference to a quest title
+    @post:  Prints the same header and lines as questQuery, but lists each quest that must be done first only once,
+            in an order where every quest comes after its dependencies.
+            If the incomplete quests in the plan contain a dependency cycle, print "Dependency cycle.\n" instead.
+*/
+void QuestList::questPlan(const std::string &quest_title)
+{
+    Quest *quest = findQuest(quest_title);
+    std::cout << "Query: " << quest_title << std::endl;
+    if (quest == nullptr)
+    {
+        std::cout << "No such quest.\n";
+        return;
+    }
+    if (quest->completed_)
+    {
+        std::cout << "Quest Complete\n";
+        return;
+    }
+    const QuestGraph &graph = getQuestGraph();
+    std::vector<int> plan;
+    if (!graph.prerequisitesOf(graph.getId(quest), plan))
+    {
+        std::cout << "Dependency cycle.\n";
+        return;
+    }
+    for (int id : plan)
+    {
+        Quest *step = graph.getQuest(id);
+        if (dependenciesComplete(step))
+        {
+            std::cout << "Ready: " << step->title_ << std::endl;
+        }
+        else
+        {
+            std::cout << "  " << step->title_ << std::endl;
+        }
+    }
+}
+
+/**
+    @return: The dependency graph of the quests in the list, in list order.
+             It is compiled on first use and again after the list or a quest's edges change through QuestList.
+*/
+const QuestGraph &QuestList::getQuestGraph() const
+{
+    if (graph_dirty_)
+    {
+        std::vector<Quest *> quests;
+        quests.reserve(item_count_);
+        for (Quest *quest : *this)
+        {
+            quests.push_back(quest);
+        }
+        graph_.build(quests);
+        graph_dirty_ = false;
+
+        int count = graph_.getQuestCount();
+        unmet_dependencies_.assign(count, 0);
+        available_bits_.assign((count + 63) / 64, 0);
+        available_words_.assign((available_bits_.size() + 63) / 64, 0);
+        for (int id = 0; id < count; id++)
+        {
+            // every dependency counts, including quests outside the list that the graph has no edge to
+            for (Quest *dependency : graph_.getQuest(id)->dependencies_)
+            {
+                if (!dependency->completed_)
+                {
+                    unmet_dependencies_[id]++;
+                }
+            }
+            updateAvailability(id);
+        }
+        projected_experience_.assign(count, 0);
+        pathway_experience_.assign(count, 0);
+        experience_state_.assign(count, XP_STALE);
+        linkOutsideSubquests();
+    }
+    return graph_;
+}
+
+/**
+    Helper Function
+    @post: outside_parents_[id] lists every quest in the list that reaches quest id through subquests that are not in
+           the list, which the graph has no edges for, so invalidateExperience can drop their totals too
+*/
+void QuestList::linkOutsideSubquests() const
+{
+    int count = graph_.getQuestCount();
+    outside_parents_.assign(count, std::vector<int>());
+    std::vector<Quest *> stack;
+    std::unordered_set<Quest *> seen;
+    for (int id = 0; id < count; id++)
+    {
+        stack.clear();
+        seen.clear();
+        for (Quest *subquest : graph_.getQuest(id)->subquests_)
+        {
+            if (graph_.getId(subquest) == -1 && seen.insert(subquest).second)
+            {
+                stack.push_back(subquest);
+            }
+        }
+        while (!stack.empty())
+        {
+            Quest *outside = stack.back();
+            stack.pop_back();
+            for (Quest *subquest : outside->subquests_)
+            {
+                if (!seen.insert(subquest).second)
+                {
+                    continue;
+                }
+                int target = graph_.getId(subquest);
+                if (target == -1)
+                {
+                    stack.push_back(subquest);
+                }
+                else
+                {
+                    outside_parents_[target].push_back(id);
+                }
+            }
+        }
+    }
+}
+
+/**
+    Helper Function
+    @param: A quest id in graph_
+    @post: The quest's bit in available_bits_ is set exactly when it is incomplete and has no unmet dependencies
+*/
+void QuestList::updateAvailability(int id) const
+{
+    bool available = unmet_dependencies_[id] == 0 && !graph_.getQuest(id)->completed_;
+    size_t word = id / 64;
+    std::uint64_t &bits = available_bits_[word];
+    if (available)
+    {
+        bits |= std::uint64_t(1) << (id % 64);
+    }
+    else
+    {
+        bits &= ~(std::uint64_t(1) << (id % 64));
+    }
+    if (bits != 0)
+    {
+        available_words_[word / 64] |= std::uint64_t(1) << (word % 64);
+    }
+    else
+    {
+        available_words_[word / 64] &= ~(std::uint64_t(1) << (word % 64));
+    }
+}
+
+/**
+    @param: True if from now on every change to a quest's completed_ or experience_points_ goes through
+            setQuestComplete or setQuestExperience
+    @post: With true, the cached values are compiled again on next use and then kept up to date by those functions.
+           With false, the functions that would use them read the quests live.
+*/
+void QuestList::setStatusTracking(bool tracked)
+{
+    if (tracked && !status_tracked_)
+    {
+        graph_dirty_ = true; // the cached values may have gone stale while untracked
+    }
+    status_tracked_ = tracked;
+}
+
+/**
+    @param: A string reference to a quest title, and the completion status to give it
+    @post: Sets the quest's completed_ and updates the count of unmet dependencies of every quest that depends on it
+    @return: False if there is no quest with the given title, True otherwise
+*/
+bool QuestList::setQuestComplete(const std::string &quest_title, bool completed)
+{
+    Quest *quest = findQuest(quest_title);
+    if (quest == nullptr)
+    {
+        return false;
+    }
+    setQuestComplete(quest, completed);
+    return true;
+}
+
+/**
+    @param: A quest pointer, in the list or not, and the completion status to give it
+    @post: Sets the quest's completed_ and updates the count of unmet dependencies of every quest that depends on it.
+           For a quest that is not in the list, the quest graph is compiled again on next use instead.
+*/
+void QuestList::setQuestComplete(Quest *quest, bool completed)
+{
+    if (quest->completed_ == completed)
+    {
+        return;
+    }
+    const QuestGraph &graph = getQuestGraph(); // compiled before the change, so the counts match the old status
+    quest->completed_ = completed;
+    int id = graph.getId(quest);
+    if (id == -1)
+    {
+        graph_dirty_ = true; // the graph has no edges from it to the quests that depend on it
+        return;
+    }
+    for (const int *dependent = graph.dependentsBegin(id); dependent != graph.dependentsEnd(id); dependent++)
+    {
+        unmet_dependencies_[*dependent] += completed ? -1 : 1;
+        updateAvailability(*dependent);
+    }
+    updateAvailability(id);
+    invalidateExperience(id);
+}
+
+/**
+    @param: A string reference to a quest title, and the experience points to give it
+    @post: Sets the quest's experience_points_ and drops the cached experience totals that include it
+    @return: False if there is no quest with the given title, True otherwise
+*/
+bool QuestList::setQuestExperience(const std::string &quest_title, int experience_points)
+{
+    Quest *quest = findQuest(quest_title);
+    if (quest == nullptr)
+    {
+        return false;
+    }
+    setQuestExperience(quest, experience_points);
+    return true;
+}
+
+/**
+    @param: A quest pointer, in the list or not, and the experience points to give it
+    @post: Sets the quest's experience_points_ and drops the cached experience totals that include it.
+           For a quest that is not in the list, the quest graph is compiled again on next use instead.
+*/
+void QuestList::setQuestExperience(Quest *quest, int experience_points)
+{
+    const QuestGraph &graph = getQuestGraph();
+    quest->experience_points_ = experience_points;
+    int id = graph.getId(quest);
+    if (id == -1)
+    {
+        graph_dirty_ = true; // the quests in the list that reach it through subquests are not known one by one
+        return;
+    }
+    invalidateExperience(id);
+}
+
+/**
+    @param: The number of threads to use
+    @return: The projected and pathway experience of every quest, indexed by position in the list
+*/
+std::vector<QuestExperience> QuestList::calculateAllExperience(unsigned threads)
+{
+    const QuestGraph &graph = getQuestGraph();
+    int count = graph.getQuestCount();
+    std::vector<QuestExperience> results(count, QuestExperience{0, 0});
+    if (threads == 0)
+    {
+        threads = 1;
+    }
+
+    // level 0 is every quest without subquests; a quest joins the next level once all its subquests are done
+    std::vector<int> remaining(count);
+    std::vector<int> level;
+    for (int id = 0; id < count; id++)
+    {
+        remaining[id] = graph.subquestsEnd(id) - graph.subquestsBegin(id);
+        if (remaining[id] == 0)
+        {
+            level.push_back(id);
+        }
+    }
+
+    // the totals of one slice of a level
+    auto addUp = [&](size_t first, size_t last)
+    {
+        std::vector<char> on_path; // each slice marks its own walks, sized on first use
+        for (size_t i = first; i < last; i++)
+        {
+            int id = level[i];
+            Quest *quest = graph.getQuest(id);
+            QuestExperience total{quest->experience_points_, quest->completed_ ? quest->experience_points_ : 0};
+            for (const int *subquest = graph.subquestsBegin(id); subquest != graph.subquestsEnd(id); subquest++)
+            {
+                total.projected_ += results[*subquest].projected_;
+                total.pathway_ += results[*subquest].pathway_;
+            }
+            addOutsideSubquests(id, total.projected_, total.pathway_, false, on_path);
+            results[id] = total;
+        }
+    };
+
+    const size_t PARALLEL_LEVEL_SIZE = 4096; // smaller levels are not worth splitting across threads
+    std::vector<int> next_level;
+    while (!level.empty())
+    {
+        if (threads == 1 || level.size() < PARALLEL_LEVEL_SIZE)
+        {
+            addUp(0, level.size());
+        }
+        else
+        {
+            if (!experience_pool_ || experience_pool_->getWorkerCount() != threads)
+            {
+                experience_pool_ = std::make_unique<WorkerPool>(threads);
+            }
+            size_t slice = (level.size() + threads - 1) / threads;
+            experience_pool_->runShards([&](unsigned shard) // the calling thread takes the first slice
+                                        { addUp(std::min(shard * slice, level.size()), std::min((shard + 1) * slice, level.size())); });
+        }
+
+        next_level.clear();
+        for (int id : level)
+        {
+            projected_experience_[id] = results[id].projected_;
+            pathway_experience_[id] = results[id].pathway_;
+            experience_state_[id] = XP_CACHED;
+            for (const int *parent = graph.parentsBegin(id); parent != graph.parentsEnd(id); parent++)
+            {
+                if (--remaining[*parent] == 0)
+                {
+                    next_level.push_back(*parent);
+                }
+            }
+        }
+        level.swap(next_level);
+    }
+
+    // quests on or above a subquest cycle never reach a level; they get the same totals as one at a time
+    for (int id = 0; id < count; id++)
+    {
+        if (remaining[id] != 0)
+        {
+            cacheExperience(id);
+            results[id] = QuestExperience{projected_experience_[id], pathway_experience_[id]};
+        }
+    }
+    return results;
+}
+
+/**
+    Helper Function
+    @param: A quest id in graph_
+    @post: The quest's projected and pathway experience are cached, along with those of all its subquests
+*/
+void QuestList::cacheExperience(int id) const
+{
+    if (experience_state_[id] != XP_STALE)
+    {
+        return;
+    }
+    // Depth first with an explicit stack: each frame is a quest being counted and its next subquest to visit.
+    // A quest's totals are added up once every subquest below it is cached.
+    std::vector<std::pair<int, const int *>> stack;
+    experience_state_[id] = XP_COUNTING;
+    stack.push_back({id, graph_.subquestsBegin(id)});
+    while (!stack.empty())
+    {
+        int current = stack.back().first;
+        if (stack.back().second != graph_.subquestsEnd(current))
+        {
+            int subquest = *stack.back().second++;
+            if (experience_state_[subquest] == XP_STALE)
+            {
+                experience_state_[subquest] = XP_COUNTING;
+                stack.push_back({subquest, graph_.subquestsBegin(subquest)});
+            }
+            continue;
+        }
+        Quest *quest = graph_.getQuest(current);
+        int projected = quest->experience_points_;
+        int pathway = quest->completed_ ? quest->experience_points_ : 0;
+        for (const int *subquest = graph_.subquestsBegin(current); subquest != graph_.subquestsEnd(current); subquest++)
+        {
+            if (experience_state_[*subquest] == XP_CACHED) // a subquest still being counted is on a cycle and is left out
+            {
+                projected += projected_experience_[*subquest];
+                pathway += pathway_experience_[*subquest];
+            }
+        }
+        addOutsideSubquests(current, projected, pathway, true, experience_marks_);
+        projected_experience_[current] = projected;
+        pathway_experience_[current] = pathway;
+        experience_state_[current] = XP_CACHED;
+        stack.pop_back();
+    }
+}
+
+/**
+    Helper Function
+    @param: A quest id in graph_, the quest's totals so far, whether quests in the list met below may use their cached
+            totals, and the marks sumExperience walks with
+    @post: The totals of the quest's subquests that are not in the list (the graph has no edge to them) are added.
+           Without use_cache only on_path is written, so several threads with their own marks may call it at once.
+*/
+void QuestList::addOutsideSubquests(int id, int &projected, int &pathway, bool use_cache, std::vector<char> &on_path) const
+{
+    Quest *quest = graph_.getQuest(id);
+    if (quest->subquests_.size() == static_cast<size_t>(graph_.subquestsEnd(id) - graph_.subquestsBegin(id)))
+    {
+        return; // every subquest is in the list
+    }
+    for (Quest *subquest : quest->subquests_)
+    {
+        if (graph_.getId(subquest) == -1)
+        {
+            int subquest_projected = 0;
+            int subquest_pathway = 0;
+            sumExperience(subquest, subquest_projected, subquest_pathway, use_cache, on_path);
+            projected += subquest_projected;
+            pathway += subquest_pathway;
+        }
+    }
+}
+
+/**
+    Helper Function
+    @param: A quest, the totals to fill, whether quests in the list may use their cached totals, and marks by graph id
+            that are all 0 (they are sized to the graph if they are not, and are all 0 again on return)
+    @post: projected and pathway hold the quest's projected and pathway experience. With use_cache, subquests in the list
+           use their cached totals (one still being counted is on a cycle and is left out); every other subquest is walked
+           with an explicit stack, skipping any that are already on it (a cycle).
+*/
+void QuestList::sumExperience(Quest *main_quest, int &projected, int &pathway, bool use_cache, std::vector<char> &on_path) const
+{
+    const QuestGraph &graph = getQuestGraph();
+    if (on_path.size() != static_cast<size_t>(graph.getQuestCount()))
+    {
+        on_path.assign(graph.getQuestCount(), 0);
+    }
+    std::unordered_set<Quest *> outside_path; // quests on the stack that are not in the list; rarely used
+    std::vector<WalkFrame> stack;
+    projected = main_quest->experience_points_;
+    pathway = main_quest->completed_ ? main_quest->experience_points_ : 0;
+    stack.push_back(walkFrame(main_quest, graph.getId(main_quest), true));
+    enterPath(on_path, outside_path, main_quest, stack.back().id_);
+    while (!stack.empty())
+    {
+        WalkFrame &frame = stack.back();
+        if (frame.next_ == frame.quest_->subquests_.size())
+        {
+            leavePath(on_path, outside_path, frame.quest_, frame.id_);
+            stack.pop_back();
+            continue;
+        }
+        Quest *subquest = frame.quest_->subquests_[frame.next_++];
+        int id = childId(frame, subquest, true);
+        if (use_cache && id != -1)
+        {
+            cacheExperience(id);
+            if (experience_state_[id] == XP_CACHED)
+            {
+                projected += projected_experience_[id];
+                pathway += pathway_experience_[id];
+            }
+        }
+        else if (!onPath(on_path, outside_path, subquest, id))
+        {
+            projected += subquest->experience_points_;
+            pathway += subquest->completed_ ? subquest->experience_points_ : 0;
+            enterPath(on_path, outside_path, subquest, id);
+            stack.push_back(walkFrame(subquest, id, true));
+        }
+    }
+}
+
+/**
+    Helper Function
+    @param: A quest, its graph id or -1 if it is not in the list, and whether the walk follows subquests or dependencies
+    @return: A stack frame that starts at the quest's first subquest or dependency
+*/
+QuestList::WalkFrame QuestList::walkFrame(Quest *quest, int id, bool subquests) const
+{
+    const int *edge = nullptr;
+    if (id != -1)
+    {
+        edge = subquests ? graph_.subquestsBegin(id) : graph_.dependenciesBegin(id);
+    }
+    return WalkFrame{quest, id, 0, edge};
+}
+
+/**
+    Helper Function
+    @param: A stack frame, and the subquest or dependency it is about to visit
+    @return: The graph id of that quest, or -1 if it is not in the list.
+             The graph has an edge for each one in the list, in the same order, so a quest in the list is its frame's next
+             edge and no hash lookup is needed; only a quest outside the list, which has no edges, looks its children up.
+*/
+int QuestList::childId(WalkFrame &frame, Quest *child, bool subquests) const
+{
+    if (frame.id_ == -1)
+    {
+        return graph_.getId(child);
+    }
+    const int *end = subquests ? graph_.subquestsEnd(frame.id_) : graph_.dependenciesEnd(frame.id_);
+    if (frame.edge_ != end && graph_.getQuest(*frame.edge_) == child)
+    {
+        return *frame.edge_++;
+    }
+    return -1;
+}
+
+/**
+    Helper Function
+    @param: The marks of a walk by graph id, the quests outside the list on its stack, and a quest with its graph id
+    @return: True if the quest is on the walk's stack
+*/
+bool QuestList::onPath(const std::vector<char> &marks, const std::unordered_set<Quest *> &outside, Quest *quest, int id)
+{
+    return id != -1 ? marks[id] != 0 : outside.count(quest) != 0;
+}
+
+/**
+    Helper Function
+    @param: The marks of a walk by graph id, the quests outside the list on its stack, and a quest with its graph id
+    @post: The quest is marked as on the walk's stack
+*/
+void QuestList::enterPath(std::vector<char> &marks, std::unordered_set<Quest *> &outside, Quest *quest, int id)
+{
+    if (id != -1)
+    {
+        marks[id] = 1;
+    }
+    else
+    {
+        outside.insert(quest);
+    }
+}
+
+/**
+    Helper Function
+    @param: The marks of a walk by graph id, the quests outside the list on its stack, and a quest with its graph id
+    @post: The quest is no longer marked as on the walk's stack
+*/
+void QuestList::leavePath(std::vector<char> &marks, std::unordered_set<Quest *> &outside, Quest *quest, int id)
+{
+    if (id != -1)
+    {
+        marks[id] = 0;
+    }
+    else
+    {
+        outside.erase(quest);
+    }
+}
+
+/**
+    Helper Function
+    @param: A quest id in graph_
+    @post: The cached totals of the quest and of every quest it is a subquest of, directly or not, are dropped.
+           A quest is only cached while all its subquests are, so the walk stops at quests that are already stale.
+*/
+void QuestList::invalidateExperience(int id) const
+{
+    std::vector<int> stack(1, id);
+    while (!stack.empty())
+    {
+        int current = stack.back();
+        stack.pop_back();
+        if (experience_state_[current] == XP_STALE)
+        {
+            continue;
+        }
+        experience_state_[current] = XP_STALE;
+        stack.insert(stack.end(), graph_.parentsBegin(current), graph_.parentsEnd(current));
+        stack.insert(stack.end(), outside_parents_[current].begin(), outside_parents_[current].end());
+    }
+}
+
+/**
+    @post: The quest graph is compiled again on next use.
+*/
+void QuestList::invalidateQuestGraph()
+{
+    graph_dirty_ = true;
+}
+
 /**
     @return: An integer sum of all the experience gained
     Note: This should only include experience from completed quests
@@ -389,12 +1193,9 @@ int QuestList::calculateGainedExperience()
 */
 int QuestList::calculateProjectedExperience(Quest *main_quest)
 {
-    int projected_experience = main_quest->experience_points_;
-    for (int i = 0; i < main_quest->subquests_.size(); i++)
-    {
-        Quest *subquest = main_quest->subquests_[i];
-        projected_experience += calculateProjectedExperience(subquest);
-    }
+    int projected_experience = 0;
+    int pathway_experience = 0;
+    experienceOf(main_quest, projected_experience, pathway_experience);
     return projected_experience;
 }
 
@@ -405,17 +1206,29 @@ int QuestList::calculateProjectedExperience(Quest *main_quest)
 */
 int QuestList::calculatePathwayExperience(Quest *main_quest)
 {
+    int projected_experience = 0;
     int pathway_experience = 0;
-    if (main_quest->completed_)
-    {
-        pathway_experience += main_quest->experience_points_;
-    }
-    for (int i = 0; i < main_quest->subquests_.size(); i++)
+    experienceOf(main_quest, projected_experience, pathway_experience);
+    return pathway_experience;
+}
+
+/**
+    Helper Function
+    @param: A quest pointer, and the totals to fill
+    @post: projected and pathway hold the quest's projected and pathway experience: the cached totals when status is
+           tracked and the quest is in the list, otherwise one walk over its subquests that adds up both
+*/
+void QuestList::experienceOf(Quest *quest, int &projected, int &pathway)
+{
+    int id = status_tracked_ ? getQuestGraph().getId(quest) : -1;
+    if (id != -1)
     {
-        Quest *subquest = main_quest->subquests_[i];
-        pathway_experience += calculatePathwayExperience(subquest);
+        cacheExperience(id);
+        projected = projected_experience_[id];
+        pathway = pathway_experience_[id];
+        return;
     }
-    return pathway_experience;
+    sumExperience(quest, projected, pathway, status_tracked_, experience_marks_);
 }
 
 /**
@@ -437,6 +1250,24 @@ void QuestList::questHistory(const std::string &quest_filter)
         std::cout << "Invalid Filter" << std::endl;
         return;
     }
+    if (quest_filter == "AVAILABLE" && status_tracked_)
+    {
+        // the available set is kept up to date, so only the words holding available quests are visited;
+        // ids are list positions, so walking the bits upwards prints in list order
+        getQuestGraph();
+        for (size_t summary = 0; summary < available_words_.size(); summary++)
+        {
+            for (std::uint64_t words = available_words_[summary]; words != 0; words &= words - 1)
+            {
+                size_t word = summary * 64 + __builtin_ctzll(words);
+                for (std::uint64_t bits = available_bits_[word]; bits != 0; bits &= bits - 1)
+                {
+                    printQuest(graph_.getQuest(word * 64 + __builtin_ctzll(bits)));
+                }
+            }
+        }
+        return;
+    }
     while (head != nullptr)
     {
         if (quest_filter == "NONE")
@@ -489,17 +1320,29 @@ void QuestList::printQuestDetails(Quest *main_quest)
     {
         return;
     }
-    int pathway_total = calculatePathwayExperience(main_quest);
-    int projected_total = calculateProjectedExperience(main_quest);
-    int experience_percentage = 0;
-    if (projected_total > 0)
+    // Each frame is a quest whose subquests are being printed and the next one to print. Quests on the stack are marked
+    // by graph id and skipped if met again, so a subquest cycle cannot print forever.
+    const QuestGraph &graph = getQuestGraph();
+    if (path_marks_.size() != static_cast<size_t>(graph.getQuestCount()))
     {
-        experience_percentage = floor(((double)pathway_total / projected_total) * 100);
+        path_marks_.assign(graph.getQuestCount(), 0);
     }
-    std::cout << main_quest->title_ << " (" << experience_percentage << "% Complete)" << std::endl;
-    for (int i = 0; i < main_quest->subquests_.size(); i++)
+    std::unordered_set<Quest *> outside_path; // quests on the stack that are not in the list; rarely used
+    path_stack_.clear();
+    printQuestProgress(main_quest);
+    path_stack_.push_back(walkFrame(main_quest, graph.getId(main_quest), true));
+    enterPath(path_marks_, outside_path, main_quest, path_stack_.back().id_);
+    while (!path_stack_.empty())
     {
-        Quest *subquest = main_quest->subquests_[i];
+        WalkFrame &frame = path_stack_.back();
+        if (frame.next_ == frame.quest_->subquests_.size())
+        {
+            leavePath(path_marks_, outside_path, frame.quest_, frame.id_);
+            path_stack_.pop_back();
+            continue;
+        }
+        Quest *subquest = frame.quest_->subquests_[frame.next_++];
+        int id = childId(frame, subquest, true);
         std::cout << "  ";
         std::cout << subquest->title_ << ": ";
         if (subquest->completed_)
@@ -510,26 +1353,81 @@ void QuestList::printQuestDetails(Quest *main_quest)
         {
             std::cout << "Not Complete" << std::endl;
         }
-        printQuestDetails(subquest);
+        if (!onPath(path_marks_, outside_path, subquest, id))
+        {
+            printQuestProgress(subquest);
+            enterPath(path_marks_, outside_path, subquest, id);
+            path_stack_.push_back(walkFrame(subquest, id, true));
+        }
     }
 }
-void QuestList::recursiveQuestQuery(Quest *const &quest)
+
+/**
+    Helper Function
+    @param: A quest pointer
+    @post: Prints "[Quest Title] ([Percent]% Complete)", the share of the quest's projected experience already gained
+*/
+void QuestList::printQuestProgress(Quest *quest)
 {
+    int projected_total = 0;
+    int pathway_total = 0;
+    experienceOf(quest, projected_total, pathway_total); // both totals from one walk when they are not cached
+    int experience_percentage = 0;
+    if (projected_total > 0)
+    {
+        experience_percentage = floor(((double)pathway_total / projected_total) * 100);
+    }
+    std::cout << quest->title_ << " (" << experience_percentage << "% Complete)" << std::endl;
+}
 
+/**
+    @param: A quest pointer to an incomplete quest
+    @post: Prints the lines of questQuery for the quest: every incomplete dependency first, depth first, with quests whose
+           dependencies are complete printed as "Ready: [Quest Title]" and the others as "  [Quest Title]" after their own dependencies.
+           Uses an explicit stack, so chains of any depth are safe; a dependency that is already on the stack (a cycle) is skipped.
+*/
+void QuestList::recursiveQuestQuery(Quest *const &quest)
+{
     if (quest->dependencies_.size() == 0 || dependenciesComplete(quest))
     {
-
         std::cout << "Ready: " << quest->title_ << std::endl;
         return;
     }
-    for (int i = 0; i < quest->dependencies_.size(); i++)
+    // each frame is a quest whose dependencies are being visited and the next one to visit; quests on the stack are
+    // marked by graph id
+    const QuestGraph &graph = getQuestGraph();
+    if (path_marks_.size() != static_cast<size_t>(graph.getQuestCount()))
     {
-
-        if (!quest->dependencies_[i]->completed_)
+        path_marks_.assign(graph.getQuestCount(), 0);
+    }
+    std::unordered_set<Quest *> outside_path; // quests on the stack that are not in the list; rarely used
+    path_stack_.clear();
+    path_stack_.push_back(walkFrame(quest, graph.getId(quest), false));
+    enterPath(path_marks_, outside_path, quest, path_stack_.back().id_);
+    while (!path_stack_.empty())
+    {
+        WalkFrame &frame = path_stack_.back();
+        if (frame.next_ == frame.quest_->dependencies_.size())
         {
-
-            recursiveQuestQuery(quest->dependencies_[i]);
+            std::cout << "  " << frame.quest_->title_ << std::endl;
+            leavePath(path_marks_, outside_path, frame.quest_, frame.id_);
+            path_stack_.pop_back();
+            continue;
+        }
+        Quest *dependency = frame.quest_->dependencies_[frame.next_++];
+        int id = childId(frame, dependency, false);
+        if (dependency->completed_ || onPath(path_marks_, outside_path, dependency, id))
+        {
+            continue;
+        }
+        if (dependency->dependencies_.size() == 0 || dependenciesComplete(dependency))
+        {
+            std::cout << "Ready: " << dependency->title_ << std::endl;
+        }
+        else
+        {
+            enterPath(path_marks_, outside_path, dependency, id);
+            path_stack_.push_back(walkFrame(dependency, id, false));
         }
     }
-    std::cout << "  " << quest->title_ << std::endl;
-}
\ No newline at end of file
+}
@@ -14,7 +14,18 @@
 #include <fstream>
 #include <sstream>
 #include <cmath>
+#include <unordered_map>
+#include <unordered_set>
+#include <string_view>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <memory>
 #include "DoublyLinkedList.hpp"
+#include "QuestGraph.hpp"
+#include "Instrumentation.hpp"
+#include "WorkerPool.hpp"
 
 struct Quest
 {
@@ -41,6 +52,21 @@ struct Quest
     */
     Quest(const std::string &title, const std::string &description, const bool &completed, const int &experience_points, const std::vector<Quest *> &dependencies, const std::vector<Quest *> &subquests) : title_{title}, description_{description}, completed_{completed}, experience_points_{experience_points}, dependencies_{dependencies}, subquests_{subquests} {};
 };
+struct QuestLoadStats
+{
+    size_t rows_;    // number of quest rows read
+    size_t bytes_;   // size of the input file
+    size_t quests_;  // number of quests created, including "NOT DISCOVERED" ones
+    size_t edges_;   // number of dependency and subquest references resolved
+    double seconds_; // wall time taken to load the file
+};
+
+struct QuestExperience
+{
+    int projected_; // what calculateProjectedExperience returns for the quest
+    int pathway_;   // what calculatePathwayExperience returns for the quest
+};
+
 class QuestList : public DoublyLinkedList<Quest *>
 {
 public:
@@ -49,6 +75,12 @@ public:
     */
     QuestList();
 
+    /**
+    Copy Constructor
+    @post: The new list holds the same quest pointers, and its own title index.
+    */
+    QuestList(const QuestList &a_list);
+
     /**
     @param: a reference to string name of an input file
     @pre: Formatting of the csv file is as follows:
@@ -70,13 +102,21 @@ public:
             - Dependencies: An empty vector
             - Subquests: An empty vector
         - However, if you eventually encounter a quest that matches one of the "NOT DISCOVERED" quests while parsing the file, you should update all the quest details.
-        Hint: update as needed using addQuest()
-
+    The file is loaded in two passes: the first splits every row and gives each distinct title a dense id, the second creates the quests
+    and resolves dependencies and subquests by id. Loading is O(rows + dependencies + subquests); see getLoadStats().
 
     @post: Each line of the input file corresponds to a quest to be added to the list. No duplicates are allowed.
+           Quests appear in the order their titles are first mentioned in the file.
     */
     QuestList(const std::string &input_file_name);
 
+    /**
+    @return: Statistics about the file this list was loaded from: rows, bytes, quests, edges and the time taken.
+             All zero if the list was not loaded from a file.
+    Example: stats.rows_ / stats.seconds_ is the load throughput in rows per second.
+    */
+    QuestLoadStats getLoadStats() const;
+
     /**
     @param: A string reference to a quest title
     @return: The integer position of the given quest if it is in the QuestList, -1 if not found.
@@ -89,6 +129,38 @@ public:
     */
     bool contains(const std::string &quest_title) const;
 
+    /**
+    @param: A string reference to a quest title
+    @return: A pointer to the first quest in the list with the given title, nullptr if not found.
+    Note: Title lookups (findQuest, contains, getPosOf) use a hash index kept in sync by insert and remove, so they are O(1).
+          A quest's title_ must not be changed while it is in the list.
+    */
+    Quest *findQuest(const std::string &quest_title) const;
+
+    /**
+    @param: The position of insertion and a quest pointer
+    @post: Inserts the quest like DoublyLinkedList::insert, and records it in the title index.
+           Appending (position >= item count) is O(1); inserting earlier in the list updates the index positions of the quests after it.
+    @return: true always
+    */
+    bool insert(size_t position, Quest *const &new_element) override;
+
+    /**
+    @param: The position of deletion
+    @post: Removes the node like DoublyLinkedList::remove, and keeps the title index in sync.
+    @return: true if there is a node at position to be deleted, false otherwise
+    */
+    bool remove(size_t position) override;
+
+    /**
+    @post: The list and the title index are empty
+    */
+    void clear() override;
+
+    // Swapping reorders the list, so the title index is rebuilt afterwards
+    void swapNode(int i, int j) override;
+    void swap(int i, int j) override;
+
     /**
     @pre: The given quest is not already in the QuestList
     @param:  A pointer to a Quest object
@@ -172,6 +244,60 @@ public:
     */
     void questQuery(const std::string &quest_title);
 
+    /**
+    @param: A string reference to a quest title
+    @post:  Prints the same header and lines as questQuery, but lists each quest that must be done first only once,
+            in an order where every quest comes after its dependencies:
+
+            Query: [Quest Title]
+            Ready: [Dependency0]
+            Ready: [Dependency1]
+              [Dependency2]
+              [Quest Title]
+
+            Quests whose dependencies are all complete are printed as "Ready: ", the rest are indented.
+            If the incomplete quests in the plan contain a dependency cycle, print "Dependency cycle.\n" instead.
+    Note: Uses the compiled quest graph, so shared dependencies are visited once instead of once per path to them.
+    */
+    void questPlan(const std::string &quest_title);
+
+    /**
+    @return: The dependency graph of the quests in the list, in list order.
+             It is compiled on first use and again after the list or a quest's edges change through QuestList.
+    */
+    const QuestGraph &getQuestGraph() const;
+
+    /**
+    @post: The quest graph is compiled again on next use.
+           Call this after changing a quest's dependencies_, subquests_ or completed_ directly.
+    */
+    void invalidateQuestGraph();
+
+    /**
+    @param: True if every change to a quest's completed_ or experience_points_ goes through setQuestComplete or
+            setQuestExperience (the default), false if callers may change them directly
+    @post: With true, questHistory("AVAILABLE") and the experience totals use values cached with the quest graph and
+           kept up to date by those two functions. They are compiled again first, as they may have gone stale before.
+           With false, those functions read the quests live, so changing completed_ or experience_points_ directly is safe.
+           A quest held by several lists is only tracked by the list it is changed through.
+    */
+    void setStatusTracking(bool tracked);
+
+    /**
+    @param: A string reference to a quest title, and the completion status to give it (default true)
+    @post: Sets the quest's completed_ and updates the count of unmet dependencies of every quest that depends on it,
+           moving quests in or out of the set of available quests. O(number of quests that depend on it).
+    @return: False if there is no quest with the given title, True otherwise
+    */
+    bool setQuestComplete(const std::string &quest_title, bool completed = true);
+
+    /**
+    @param: A quest pointer, in the list or not, and the completion status to give it (default true)
+    @post: Sets the quest's completed_ like setQuestComplete(title). A quest that is not in the list (a dependency that
+           was never added) has no edges in the quest graph, so the graph is compiled again on next use instead.
+    */
+    void setQuestComplete(Quest *quest, bool completed = true);
+
     /**
     @return: An integer sum of all the experience gained
     Note: This should only include experience from completed quests
@@ -189,9 +315,40 @@ public:
     @param: A quest pointer to a main quest
     @return: An integer sum of all the experience that has already been gained by completing the given quest's subquests.
     Note: Also consider the experience gained if a completed subquest itself has subquests.
+          With status tracking on (the default, see setStatusTracking), both totals are cached per quest once computed, and
+          a quest's cached totals (and those of every quest it is a subquest of) are dropped when setQuestComplete or
+          setQuestExperience changes it, so repeated calls are O(1). Otherwise every subquest is walked on each call.
+          Either way, subquests that are not in the list count, and a subquest shared by several quests is counted once
+          for every path to it, as before.
     */
     int calculatePathwayExperience(Quest *main_quest);
 
+    /**
+    @param: A string reference to a quest title, and the experience points to give it
+    @post: Sets the quest's experience_points_ and drops the cached experience totals that include it
+    @return: False if there is no quest with the given title, True otherwise
+    */
+    bool setQuestExperience(const std::string &quest_title, int experience_points);
+
+    /**
+    @param: A quest pointer, in the list or not, and the experience points to give it
+    @post: Sets the quest's experience_points_ like setQuestExperience(title). For a quest that is not in the list, whose
+           links to the quests above it are not tracked one by one, the quest graph is compiled again on next use instead.
+    */
+    void setQuestExperience(Quest *quest, int experience_points);
+
+    /**
+    @param: The number of threads to use (default: one per core)
+    @return: The projected and pathway experience of every quest, indexed by position in the list.
+    Note: Works bottom-up over the subquest graph one level at a time, where a quest's level is one more than its highest
+          subquest's. All quests of a level only read totals of lower levels, so wide levels are split across the threads,
+          which are started at the first wide level and kept for later calls with the same number of threads.
+          Subquests that are not in the list are walked as calculateProjectedExperience does without status tracking.
+          The totals are also stored in the cache calculateProjectedExperience and calculatePathwayExperience use.
+          O((quests + subquests) / threads) for wide graphs.
+    */
+    std::vector<QuestExperience> calculateAllExperience(unsigned threads = std::thread::hardware_concurrency());
+
     /**
     @param: A string reference to a filter with a default value of "NONE".
     @post: With default filter "NONE": Print out every quest in the list.
@@ -202,6 +359,9 @@ public:
     Printing quests should be of the form:
     [Quest title]: [Complete / Not Complete]
     [Quest description]\n
+    Note: With status tracking on (the default, see setStatusTracking), "AVAILABLE" prints from the set of available quests
+          kept by setQuestComplete, in list order, so it is O(available quests) once the quest graph is compiled (plus one
+          bit test per 4096 quests). Otherwise it checks every quest.
     */
     void questHistory(const std::string &quest_filter = "NONE");
 
@@ -218,7 +378,87 @@ public:
             Hint: You can write a helper function to print the subquests recursively. If the given quest is already marked as completed, you can assume that all of its subquests are also completed.
     */
     void printQuestDetails(Quest *main_quest);
+
+    /**
+    @param: A quest pointer to an incomplete quest
+    @post: Prints the lines questQuery prints for the quest, depth first over its incomplete dependencies.
+    Note: Despite the name this walks an explicit stack, so chains of any depth are safe, and a dependency cycle is cut
+          where it closes instead of recursing forever. printQuestDetails and the experience totals work the same way.
+    */
     void recursiveQuestQuery(Quest *const &quest);
+    void rebuildIndex();
+
+private:
+    struct QuestRow
+    {
+        int id_;                                   // dense id of the row's title
+        std::string_view description_;             // points into the file buffer
+        bool completed_;
+        int experience_points_;
+        std::pair<size_t, size_t> dependencies_;   // [first, last) in the loader's edge array
+        std::pair<size_t, size_t> subquests_;      // [first, last) in the loader's edge array
+    };
+    static std::string readQuestFile(const std::string &input_file_name);
+    static void splitQuestRows(const std::string &buffer, std::vector<QuestRow> &rows, std::vector<std::string_view> &titles, std::vector<int> &edges);
+    static std::string_view nextField(std::string_view &text, char delimiter);
+    static int parseNumber(std::string_view field);
+    friend class QuestStore; // loads the same csv files with the helpers above
+
+    QuestLoadStats load_stats_; // filled in by the file constructor
+
+    mutable QuestGraph graph_;  // compiled from the list by getQuestGraph
+    mutable bool graph_dirty_;  // true when graph_ no longer matches the list
+    bool status_tracked_;       // true when completed_ and experience_points_ only change through QuestList (see setStatusTracking)
+
+    // Availability, by graph id, compiled along with graph_ and kept up to date by setQuestComplete
+    mutable std::vector<int> unmet_dependencies_; // number of incomplete dependencies of each quest, in the list or not
+    mutable std::vector<std::uint64_t> available_bits_;  // bit id % 64 of word id / 64 is set when quest id is available
+    mutable std::vector<std::uint64_t> available_words_; // bit w % 64 of word w / 64 is set when available_bits_[w] is not 0
+    void updateAvailability(int id) const;
+
+    // Projected and pathway experience totals, by graph id, computed on demand
+    enum ExperienceState
+    {
+        XP_STALE,    // not computed, or dropped since
+        XP_COUNTING, // being computed; meeting it again means the subquests have a cycle
+        XP_CACHED
+    };
+    mutable std::vector<int> projected_experience_;
+    mutable std::vector<int> pathway_experience_;
+    mutable std::vector<ExperienceState> experience_state_;
+    void cacheExperience(int id) const;
+    void sumExperience(Quest *main_quest, int &projected, int &pathway, bool use_cache, std::vector<char> &on_path) const;
+    void experienceOf(Quest *quest, int &projected, int &pathway);
+    void addOutsideSubquests(int id, int &projected, int &pathway, bool use_cache, std::vector<char> &on_path) const;
+    std::unique_ptr<WorkerPool> experience_pool_; // the threads of calculateAllExperience, started on first use
+    mutable std::vector<std::vector<int>> outside_parents_; // quests reaching each id only through subquests not in the list
+    void linkOutsideSubquests() const;
+    void printQuestProgress(Quest *quest);
+    void invalidateExperience(int id) const;
+
+    // One quest on the stack of an iterative walk over subquests or dependencies
+    struct WalkFrame
+    {
+        Quest *quest_;    // the quest whose subquests or dependencies are being visited
+        int id_;          // its graph id, or -1 if it is not in the list
+        size_t next_;     // index of the next one to visit
+        const int *edge_; // its next graph edge; the graph has one per subquest or dependency in the list, in order
+    };
+    mutable std::vector<WalkFrame> path_stack_;  // the stack of printQuestDetails and recursiveQuestQuery
+    mutable std::vector<char> path_marks_;       // by graph id: 1 while the quest is on path_stack_
+    mutable std::vector<char> experience_marks_; // by graph id: 1 while the quest is on the stack of sumExperience
+    WalkFrame walkFrame(Quest *quest, int id, bool subquests) const;
+    int childId(WalkFrame &frame, Quest *child, bool subquests) const;
+    static bool onPath(const std::vector<char> &marks, const std::unordered_set<Quest *> &outside, Quest *quest, int id);
+    static void enterPath(std::vector<char> &marks, std::unordered_set<Quest *> &outside, Quest *quest, int id);
+    static void leavePath(std::vector<char> &marks, std::unordered_set<Quest *> &outside, Quest *quest, int id);
+
+    struct IndexEntry
+    {
+        Node<Quest *> *node_; // the first node in the list holding a quest with this title
+        size_t position_;     // the position of that node
+    };
+    std::unordered_map<std::string, IndexEntry> title_index_; // quest title -> first node with that title
 };
 
 #endif
\ No newline at end of file
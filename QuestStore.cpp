@@ -0,0 +1,282 @@
+/*
+ * File Title: QuestStore.cpp
+ * Author: Mahim Ali
+ * Date: October 19, 2026
+ * This file implements a class called QuestStore
+ */
+#include "QuestStore.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include "QuestList.hpp"
+
+/*
+    Default Constructor
+    @post: An empty store
+*/
+QuestStore::QuestStore()
+{
+}
+
+/*
+    @param: A quest list
+    @post: Holds a copy of every quest in the list, with ids equal to list positions
+*/
+QuestStore::QuestStore(const QuestList &quests)
+{
+    std::unordered_map<std::string_view, std::uint32_t> descriptions; // description -> offset, viewing the quests' own strings
+    std::unordered_map<const Quest *, int> ids;
+    ids.reserve(quests.getLength());
+    int id = 0;
+    for (Quest *quest : quests)
+    {
+        ids.emplace(quest, id++);
+    }
+    quests_.reserve(quests.getLength());
+    for (Quest *quest : quests)
+    {
+        QuestRecord record{};
+        record.title_ = storeText(quest->title_, nullptr);
+        record.title_length_ = quest->title_.size();
+        if (quest->description_ != "NOT DISCOVERED")
+        {
+            record.description_ = storeText(quest->description_, &descriptions);
+            record.description_length_ = quest->description_.size();
+            record.flags_ |= DISCOVERED;
+        }
+        if (quest->completed_)
+        {
+            record.flags_ |= COMPLETED;
+        }
+        record.experience_points_ = quest->experience_points_;
+        record.edges_ = edges_.size();
+        for (Quest *dependency : quest->dependencies_)
+        {
+            auto found = ids.find(dependency);
+            if (found != ids.end())
+            {
+                edges_.push_back(found->second);
+                record.dependency_count_++;
+            }
+        }
+        for (Quest *subquest : quest->subquests_)
+        {
+            auto found = ids.find(subquest);
+            if (found != ids.end())
+            {
+                edges_.push_back(found->second);
+                record.subquest_count_++;
+            }
+        }
+        quests_.push_back(record);
+    }
+    indexTitles();
+}
+
+/*
+    @param: a reference to string name of an input file, in the csv format QuestList reads
+    @post: Holds the quests of the file with the same ids, details and edges as QuestList(input_file_name) would give them
+*/
+QuestStore::QuestStore(const std::string &input_file_name)
+{
+    std::string buffer = QuestList::readQuestFile(input_file_name);
+    std::vector<QuestList::QuestRow> rows;
+    std::vector<std::string_view> titles;
+    std::vector<int> row_edges;
+    QuestList::splitQuestRows(buffer, rows, titles, row_edges);
+
+    // every quest starts as an undiscovered placeholder, as in QuestList
+    std::unordered_map<std::string_view, std::uint32_t> descriptions; // description -> offset, viewing buffer
+    quests_.assign(titles.size(), QuestRecord{});
+    for (size_t id = 0; id < titles.size(); id++)
+    {
+        quests_[id].title_ = storeText(titles[id], nullptr);
+        quests_[id].title_length_ = titles[id].size();
+    }
+    // the last row for a title decides its edges, and the first its details
+    std::vector<int> edge_row(titles.size(), -1);
+    for (size_t r = 0; r < rows.size(); r++)
+    {
+        QuestRecord &record = quests_[rows[r].id_];
+        if (edge_row[rows[r].id_] == -1)
+        {
+            if (rows[r].description_ != "NOT DISCOVERED")
+            {
+                record.description_ = storeText(rows[r].description_, &descriptions);
+                record.description_length_ = rows[r].description_.size();
+                record.flags_ |= DISCOVERED;
+            }
+            if (rows[r].completed_)
+            {
+                record.flags_ |= COMPLETED;
+            }
+            record.experience_points_ = rows[r].experience_points_;
+        }
+        edge_row[rows[r].id_] = r;
+    }
+    for (size_t id = 0; id < titles.size(); id++)
+    {
+        QuestRecord &record = quests_[id];
+        record.edges_ = edges_.size();
+        if (edge_row[id] == -1)
+        {
+            continue;
+        }
+        const QuestList::QuestRow &row = rows[edge_row[id]];
+        edges_.insert(edges_.end(), row_edges.begin() + row.dependencies_.first, row_edges.begin() + row.dependencies_.second);
+        edges_.insert(edges_.end(), row_edges.begin() + row.subquests_.first, row_edges.begin() + row.subquests_.second);
+        record.dependency_count_ = row.dependencies_.second - row.dependencies_.first;
+        record.subquest_count_ = row.subquests_.second - row.subquests_.first;
+    }
+    text_.shrink_to_fit();
+    edges_.shrink_to_fit();
+    indexTitles();
+}
+
+/*
+    @return: The number of quests in the store
+*/
+int QuestStore::getQuestCount() const
+{
+    return quests_.size();
+}
+
+/*
+    @param: A quest title
+    @return: The id of the quest with that title, -1 if there is none
+*/
+int QuestStore::findQuest(std::string_view title) const
+{
+    auto found = std::lower_bound(title_order_.begin(), title_order_.end(), title, [this](std::uint32_t id, std::string_view key)
+                                  { return getTitle(id) < key; });
+    if (found == title_order_.end() || getTitle(*found) != title)
+    {
+        return -1;
+    }
+    return *found;
+}
+
+std::string_view QuestStore::getTitle(int id) const
+{
+    return std::string_view(text_).substr(quests_[id].title_, quests_[id].title_length_);
+}
+
+std::string_view QuestStore::getDescription(int id) const
+{
+    if (!isDiscovered(id))
+    {
+        return "NOT DISCOVERED";
+    }
+    return std::string_view(text_).substr(quests_[id].description_, quests_[id].description_length_);
+}
+
+bool QuestStore::isCompleted(int id) const
+{
+    return quests_[id].flags_ & COMPLETED;
+}
+
+int QuestStore::getExperience(int id) const
+{
+    return quests_[id].experience_points_;
+}
+
+bool QuestStore::isDiscovered(int id) const
+{
+    return quests_[id].flags_ & DISCOVERED;
+}
+
+/*
+    @param: A quest id, and its new completion status
+    @post: The quest's completion status is set
+*/
+void QuestStore::setCompleted(int id, bool completed)
+{
+    if (completed)
+    {
+        quests_[id].flags_ |= COMPLETED;
+    }
+    else
+    {
+        quests_[id].flags_ &= ~COMPLETED;
+    }
+}
+
+/*
+    @param: A quest id
+    @return: The bounds of the quest's dependencies or subquests in the shared edge array
+*/
+const std::uint32_t *QuestStore::dependenciesBegin(int id) const
+{
+    return edges_.data() + quests_[id].edges_;
+}
+
+const std::uint32_t *QuestStore::dependenciesEnd(int id) const
+{
+    return dependenciesBegin(id) + quests_[id].dependency_count_;
+}
+
+const std::uint32_t *QuestStore::subquestsBegin(int id) const
+{
+    return dependenciesEnd(id);
+}
+
+const std::uint32_t *QuestStore::subquestsEnd(int id) const
+{
+    return subquestsBegin(id) + quests_[id].subquest_count_;
+}
+
+/*
+    @return: The bytes held by the store's arrays
+*/
+size_t QuestStore::getMemoryUsage() const
+{
+    return quests_.capacity() * sizeof(QuestRecord) + text_.capacity() +
+           (edges_.capacity() + title_order_.capacity()) * sizeof(std::uint32_t);
+}
+
+/*
+    Helper Function
+    @param: The text to store, and the table of texts already stored to share them, or nullptr to always append
+    @return: The offset of the text in the arena
+    @post: Exits with an error if the arena would outgrow the 32-bit offsets and lengths of a record
+*/
+std::uint32_t QuestStore::storeText(std::string_view text, std::unordered_map<std::string_view, std::uint32_t> *shared)
+{
+    if (shared != nullptr)
+    {
+        auto found = shared->find(text);
+        if (found != shared->end())
+        {
+            return found->second;
+        }
+    }
+    if (text.size() > std::numeric_limits<std::uint32_t>::max() - text_.size())
+    {
+        std::cerr << "Quest text is too large for a QuestStore." << std::endl;
+        exit(1);
+    }
+    std::uint32_t offset = text_.size();
+    text_.append(text);
+    if (shared != nullptr)
+    {
+        shared->emplace(text, offset); // the key views the caller's text, which outlives the build
+    }
+    return offset;
+}
+
+/*
+    Helper Function
+    @post: title_order_ holds every id sorted by title; called once text_ holds all the titles
+*/
+void QuestStore::indexTitles()
+{
+    title_order_.resize(quests_.size());
+    for (size_t id = 0; id < quests_.size(); id++)
+    {
+        title_order_[id] = id;
+    }
+    // ties keep id order, so findQuest gives the first id of a repeated title, like QuestList::findQuest
+    std::stable_sort(title_order_.begin(), title_order_.end(), [this](std::uint32_t lhs, std::uint32_t rhs)
+                     { return getTitle(lhs) < getTitle(rhs); });
+}
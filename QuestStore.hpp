@@ -0,0 +1,123 @@
+/*
+ * File Title: QuestStore.hpp
+ * Author: Mahim Ali
+ * Date: October 19, 2026
+ * This file is the interface of a class called QuestStore
+ */
+#ifndef QUEST_STORE_HPP
+#define QUEST_STORE_HPP
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class QuestList;
+
+/*
+    A compact, read-mostly copy of a set of quests for very large worlds.
+    Every quest is a fixed-size record addressed by a dense id. Titles and descriptions live back to back in one
+    character arena, with repeated descriptions stored once. Dependencies and subquests are ids in one shared edge
+    array, addressed by offset and length. "NOT DISCOVERED" placeholder quests store no description, only a cleared
+    discovered bit. Only completion status can change after the store is built.
+*/
+class QuestStore
+{
+public:
+    /*
+    Default Constructor
+    @post: An empty store
+    */
+    QuestStore();
+
+    /*
+    @param: A quest list
+    @post: Holds a copy of every quest in the list, with ids equal to list positions.
+           Dependencies and subquests that are not in the list are left out.
+    */
+    QuestStore(const QuestList &quests);
+
+    /*
+    @param: a reference to string name of an input file, in the csv format QuestList reads
+    @post: Holds the quests of the file with the same ids, details and edges as QuestList(input_file_name) would give
+           them, without creating any Quest objects.
+    */
+    QuestStore(const std::string &input_file_name);
+
+    /*
+    @return: The number of quests in the store
+    */
+    int getQuestCount() const;
+
+    /*
+    @param: A quest title
+    @return: The id of the quest with that title, -1 if there is none. O(log quests).
+    */
+    int findQuest(std::string_view title) const;
+
+    /*
+    @param: A quest id
+    @return: The quest's title, description ("NOT DISCOVERED" for placeholders), completion status, experience points,
+             or whether it has been discovered
+    */
+    std::string_view getTitle(int id) const;
+    std::string_view getDescription(int id) const;
+    bool isCompleted(int id) const;
+    int getExperience(int id) const;
+    bool isDiscovered(int id) const;
+
+    /*
+    @param: A quest id, and its new completion status
+    @post: The quest's completion status is set
+    */
+    void setCompleted(int id, bool completed);
+
+    /*
+    @param: A quest id
+    @return: Pointers to the first and one past the last id of the quest's dependencies or subquests
+    */
+    const std::uint32_t *dependenciesBegin(int id) const;
+    const std::uint32_t *dependenciesEnd(int id) const;
+    const std::uint32_t *subquestsBegin(int id) const;
+    const std::uint32_t *subquestsEnd(int id) const;
+
+    /*
+    @return: The bytes held by the store's arrays
+    */
+    size_t getMemoryUsage() const;
+
+private:
+    enum QuestFlags
+    {
+        COMPLETED = 1,
+        DISCOVERED = 2
+    };
+
+    struct QuestRecord
+    {
+        std::uint32_t title_;               // offset of the title in text_
+        std::uint32_t title_length_;
+        std::uint32_t description_;         // offset of the description in text_
+        std::uint32_t description_length_;
+        std::uint32_t edges_;               // offset of the dependencies in edges_; the subquests follow them
+        std::uint32_t dependency_count_;
+        std::uint32_t subquest_count_;
+        std::int32_t experience_points_;
+        std::uint8_t flags_;                // QuestFlags
+    };
+
+    /*
+    @post: Appends the text to the arena, or finds an earlier copy of it when shared is given
+    @return: The offset of the text in the arena; exits with an error past 4 GiB of text
+    */
+    std::uint32_t storeText(std::string_view text, std::unordered_map<std::string_view, std::uint32_t> *shared);
+
+    // @post: title_order_ holds every id sorted by title; called once text_ holds all the titles
+    void indexTitles();
+
+    std::vector<QuestRecord> quests_;                    // records by id
+    std::string text_;                                   // every title and description, back to back
+    std::vector<std::uint32_t> edges_;                   // dependency and subquest ids of every quest, back to back
+    std::vector<std::uint32_t> title_order_;             // ids sorted by title, then id; 4 bytes a quest instead of a hash table
+};
+#endif // QUEST_STORE_HPP
@@ -62,6 +62,7 @@ void Ranger::setArrows(const std::vector<Arrows> &arrows)
 **/
 std::vector<Arrows> Ranger::getArrows() const
 {
+    RPG_ALLOCATION_SCOPE("Ranger::getArrows");
     return arrows_;
 }
 
@@ -277,7 +278,7 @@ void Ranger::display() const
     Otherwise (not UNDEAD and not POISON affinity), their Vitality is set to 1.
     Whether the not UNDEAD Ranger has POISON affinity or not, if they have an animal companion, the emotional support allows the character to recover 1 Vitality point.
 */
-void Ranger::eatTaintedStew()
+void Ranger::eatTaintedStew(std::mt19937 &)
 {
     int vitality_points = getVitality();
     bool hasPoisonAffinity = false;
@@ -309,4 +310,12 @@ void Ranger::eatTaintedStew()
         vitality_points += 3;
     }
     setVitality(vitality_points);
-}
\ No newline at end of file
+}
+
+/**
+@return: RANGER
+*/
+Subclass Ranger::getSubclass() const
+{
+    return RANGER;
+}
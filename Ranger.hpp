@@ -148,7 +148,12 @@ public:
     Otherwise (not UNDEAD and not POISON affinity), their Vitality is set to 1.
     Whether the not UNDEAD Ranger has POISON affinity or not, if they have an animal companion, the emotional support allows the character to recover 1 Vitality point.
     */
-    void eatTaintedStew() override;
+    void eatTaintedStew(std::mt19937 &random) override;
+
+    /**
+    @return: RANGER
+    */
+    Subclass getSubclass() const override;
 };
 
 #endif
@@ -235,6 +235,7 @@ void Scoundrel::display() const
 }
 
 /**
+    @param: the random number generator the SILVERTONGUE chance is drawn from
     @post:
     If the character is UNDEAD, gain 3 Vitality points. Nothing else happens.
 
@@ -244,12 +245,10 @@ void Scoundrel::display() const
     4 Vitality points, but a 30% chance of resetting their Vitality to 1, and they lose their daggers, which are replaced with WOOD daggers.
     (If their daggers were already WOOD, nothing happens to the daggers).
 */
-void Scoundrel::eatTaintedStew()
+void Scoundrel::eatTaintedStew(std::mt19937 &random)
 {
     int vitality_points = getVitality();
-    int random = (int)time(nullptr);                                                                                        // converts time to an int value based on current time
-    srand(random);                                                                                                          // sets the initial state of numbers to be randomly generated
-    int randomNumber = rand() % 100 + 1;                                                                                    // uses random number generator to generate random number between 1 and 100.
+    int randomNumber = std::uniform_int_distribution<int>(1, 100)(random);                                                  // draws a number between 1 and 100 from the caller's generator, so taverns never share one
     if (getRace() == "HUMAN" || getRace() == "NONE" || getRace() == "ELF" || getRace() == "DWARF" || getRace() == "LIZARD") // If the Scoundrel character doesn't have race of "UNDEAD" then its vitality is set to 1.
     {
         vitality_points = 1;
@@ -278,4 +277,12 @@ void Scoundrel::eatTaintedStew()
         vitality_points += 3;
     }
     setVitality(vitality_points);
-}
\ No newline at end of file
+}
+
+/**
+@return: SCOUNDREL
+*/
+Subclass Scoundrel::getSubclass() const
+{
+    return SCOUNDREL;
+}
@@ -129,6 +129,7 @@ public:
     void display() const override;
 
     /**
+      @param: the random number generator the SILVERTONGUE chance is drawn from
       @post:
       If the character is UNDEAD, gain 3 Vitality points. Nothing else happens.
 
@@ -136,7 +137,12 @@ public:
       In addition, as a Scoundrel: If the character is of the CUTPURSE faction, they steal a health potion and recover 3 Vitality points.
       If they are of the SILVERTONGUE faction, they talk the cook into redoing their stew as follows: they have a 70% chance of recovering 4 Vitality points, but a 30% chance of resetting their Vitality to 1, and they lose their daggers, which are replaced with WOOD daggers. (If their daggers were already WOOD, nothing happens to the daggers).
     */
-    void eatTaintedStew() override;
+    void eatTaintedStew(std::mt19937 &random) override;
+
+    /**
+    @return: SCOUNDREL
+    */
+    Subclass getSubclass() const override;
 };
 
 #endif
@@ -7,7 +7,15 @@
 #include "Tavern.hpp"
 
 /** Default Constructor **/
-Tavern::Tavern() : ArrayBag<Character *>(), level_sum_{0}, num_enemies_{0}
+Tavern::Tavern() : ArrayBag<Character *>(), level_sum_{0}, num_enemies_{0}, main_character_{nullptr}, random_{}
+{
+}
+
+/**
+  @param: the most characters the tavern may hold
+  @post: an empty tavern
+*/
+Tavern::Tavern(int capacity) : ArrayBag<Character *>(capacity), level_sum_{0}, num_enemies_{0}, main_character_{nullptr}, random_{}
 {
 }
 
@@ -28,7 +36,7 @@ Tavern::Tavern() : ArrayBag<Character *>(), level_sum_{0}, num_enemies_{0}
     12. Enraged: 0 (False) or 1 (True), only applicable to Barbarians, representing if they are enraged.
   @post: Each line of the input file corresponds to a Character subclass and dynamically allocates Character derived objects, adding them to the Tavern.
 */
-Tavern::Tavern(const std::string &input_file_name) : ArrayBag<Character *>()
+Tavern::Tavern(const std::string &input_file_name) : ArrayBag<Character *>(), level_sum_{0}, num_enemies_{0}, main_character_{nullptr}, random_{}
 {
     std::string junk, line, name, race, subclass, level_str, vitality_str, armor_str, enemy_str, main, offhand, school_or_faction, summoning_str, affinity, disguise_str, enraged_str, quantity_str, Current_affinity; // variables to read each header of the csv file.
     int level, vitality, armor, quantity;                                                                                                                                                                              // variables to read each header of the csv file.
@@ -108,7 +116,10 @@ Tavern::Tavern(const std::string &input_file_name) : ArrayBag<Character *>()
         {
             character_ptr = new Ranger(name, race, vitality, armor, level, enemy, Arrows_vector, Affinities_vector, summoning);
         }
-        enterTavern(character_ptr); // after the type of the character is created then it is added to the tavern;
+        if (!enterTavern(character_ptr)) // after the type of the character is created then it is added to the tavern;
+        {
+            delete character_ptr; // the tavern is full, so the character is not kept.
+        }
         character_ptr = nullptr;    // the character pointer is set to nullptr after it is added to the tavern as it isnt being used anymore to avoid dangling pointers.
         Arrows_vector.clear();      // the arrow and affinities vector are cleared after the character is added to the tavern to not have any additional values added on from a previous character that was created.
         Affinities_vector.clear();
@@ -154,6 +165,24 @@ bool Tavern::exitTavern(Character *a_character)
     return false;
 }
 
+/** @param:   The handle the Character got when it entered the Tavern
+    @return:  returns true if the character was still in the Tavern and was removed, false otherwise
+    @post:    removes the character in O(1) and updates the level sum and the enemy count if the character is an enemy.
+**/
+bool Tavern::exitTavern(const BagHandle &handle)
+{
+    Character *a_character = nullptr;
+    if (getEntry(handle, a_character) && remove(handle))
+    {
+        level_sum_ -= a_character->getLevel();
+        if (a_character->isEnemy())
+            num_enemies_--;
+
+        return true;
+    }
+    return false;
+}
+
 /**
     @return:  The integer level count of all the characters currently in the Tavern
     **/
@@ -226,6 +255,7 @@ int Tavern::tallyRace(const std::string &race)
 */
 void Tavern::tavernReport()
 {
+    RPG_ALLOCATION_SCOPE("Tavern::tavernReport");
     int humans = tallyRace("HUMAN");
     int elves = tallyRace("ELF");
     int dwarves = tallyRace("DWARF");
@@ -247,12 +277,21 @@ void Tavern::tavernReport()
 void Tavern::displayCharacters()
 {
     // loops through all the characters in the tavern
-    for (int i = 0; i < getCurrentSize(); i++)
+    for (Character *character : characters())
     {
-        items_[i]->display(); // Every character's information is displayed if they are in the tavern.
+        character->display(); // Every character's information is displayed if they are in the tavern.
     }
 }
 
+/**
+    @param: a filter, by default one every character matches
+    @return: a lazily filtered view of the characters in the tavern, which copies and prints nothing.
+*/
+TavernView Tavern::characters(const CharacterFilter &filter) const
+{
+    return TavernView(view(), filter);
+}
+
 /**
     @param: a string reference to a race
     @post: For every character in the tavern of the given race (only exact matches to the input string), displays each character's information
@@ -271,17 +310,26 @@ void Tavern::displayRace(const std::string &race)
 }
 
 /**
-    @post: Every character in the tavern eats a tainted stew.
+    @post: Every character in the tavern eats a tainted stew, drawing any chance from the tavern's own generator.
 */
 void Tavern::taintedStew()
 {
     // loops through all the characters in the tavern.
     for (int i = 0; i < getCurrentSize(); i++)
     {
-        items_[i]->eatTaintedStew(); // Each character in the tavern eats a tainted stew.
+        items_[i]->eatTaintedStew(random_); // Each character in the tavern eats a tainted stew.
     }
 }
 
+/**
+    @param: a seed
+    @post: restarts the tavern's random number generator from the seed
+*/
+void Tavern::seedRandom(unsigned seed)
+{
+    random_.seed(seed);
+}
+
 /**
 @param: a Character pointer
 @post: sets the Tavern's main character to the pointer that is given
@@ -366,63 +414,59 @@ bool Tavern::vitalityIsGreater(Character *lhs, Character *rhs) const
 */
 void Tavern::createCombatQueue(const std::string &combat_filter)
 {
-    std::vector<Character *> my_vector; // created vector to sort based on different filters
+    RPG_ALLOCATION_SCOPE("Tavern::createCombatQueue");
+    std::vector<int> my_vector; // created vector of the indices of the enemies in items_, to sort based on different filters
     for (int i = 0; i < item_count_; i++)
     {
         if (items_[i]->isEnemy()) // for loop used to add all the enemies in to the vector
         {
-            my_vector.push_back(items_[i]);
+            my_vector.push_back(i);
         }
     }
     while (!(combat_queue_.empty()))
     {
-        combat_queue_.pop();
+        popCombatQueue();
     }
-    if (combat_filter == "NONE")
+    if (combat_filter == "LVLASC")
     {
-        for (int i = 0; i < my_vector.size(); i++)
-        {
-            combat_queue_.push(my_vector[i]); // the vector with enemies is added to the combat queue
-        }
-    }
-    else if (combat_filter == "LVLASC")
-    {
-        std::sort(my_vector.begin(), my_vector.end(), [this](Character *a, Character *b) // use of lambda expression to sort based on level ascending
-                  { return levelIsLess(a, b); });
-        for (int i = 0; i < my_vector.size(); i++)
-        {
-            combat_queue_.push(my_vector[i]); // after it is sorted based on each filter, the vector with the enemies is added to the combat queue
-        }
+        std::sort(my_vector.begin(), my_vector.end(), [this](int a, int b) // use of lambda expression to sort based on level ascending
+                  { return levelIsLess(items_[a], items_[b]); });
     }
     else if (combat_filter == "LVLDES")
     {
-        std::sort(my_vector.begin(), my_vector.end(), [this](Character *a, Character *b) // use of lambda expression to sort based on level descending
-                  { return levelIsGreater(a, b); });
-        for (int i = 0; i < my_vector.size(); i++)
-        {
-            combat_queue_.push(my_vector[i]); // after it is sorted based on each filter, the vector with the enemies is added to the combat queue
-        }
+        std::sort(my_vector.begin(), my_vector.end(), [this](int a, int b) // use of lambda expression to sort based on level descending
+                  { return levelIsGreater(items_[a], items_[b]); });
     }
     else if (combat_filter == "HPASC")
     {
-        std::sort(my_vector.begin(), my_vector.end(), [this](Character *a, Character *b) // use of lambda expression to sort based on vitality ascending
-                  { return vitalityIsLess(a, b); });
-        for (int i = 0; i < my_vector.size(); i++)
-        {
-            combat_queue_.push(my_vector[i]); // after it is sorted based on each filter, the vector with the enemies is added to the combat queue
-        }
+        std::sort(my_vector.begin(), my_vector.end(), [this](int a, int b) // use of lambda expression to sort based on vitality ascending
+                  { return vitalityIsLess(items_[a], items_[b]); });
     }
     else if (combat_filter == "HPDES")
     {
-        std::sort(my_vector.begin(), my_vector.end(), [this](Character *a, Character *b) // use of lambda expression to sort based on vitality descending
-                  { return vitalityIsGreater(a, b); });
-        for (int i = 0; i < my_vector.size(); i++)
-        {
-            combat_queue_.push(my_vector[i]); // after it is sorted based on each filter, the vector with the enemies is added to the combat queue
-        }
+        std::sort(my_vector.begin(), my_vector.end(), [this](int a, int b) // use of lambda expression to sort based on vitality descending
+                  { return vitalityIsGreater(items_[a], items_[b]); });
+    }
+    else if (combat_filter != "NONE")
+    {
+        return; // an unknown filter leaves the combat queue empty
+    }
+    for (size_t i = 0; i < my_vector.size(); i++)
+    {
+        combat_queue_.push(items_[my_vector[i]]); // after it is sorted based on the filter, each enemy is added to the combat queue
+        combat_handles_.push(getHandle(my_vector[i]));
     }
 }
 
+/**
+Helper Function
+*/
+void Tavern::popCombatQueue()
+{
+    combat_queue_.pop();
+    combat_handles_.pop();
+}
+
 /**
  @post: returns a pointer to the Character at the front of the Combat Queue.
 : If there are no characters in the queue, return nullptr
@@ -436,6 +480,14 @@ Character *Tavern::getTarget() const
     return combat_queue_.front();
 }
 
+/**
+ @return: the number of enemies waiting in the Combat Queue
+*/
+int Tavern::getCombatQueueSize() const
+{
+    return combat_queue_.size();
+}
+
 /**
  @post : Prints the details of each character in the combat queue in the following form:
 : [ENEMY NAME]: LEVEL [ENEMY LEVEL] [ENEMY RACE]. \nVITALITY: [ENEMY VITALITY] \nARMOR: [ENEMY ARMOR]\n
@@ -448,7 +500,7 @@ void Tavern::printCombatQueue()
                   << "LEVEL " << combat_queue_.front()->getLevel() << " " << combat_queue_.front()->getRace() << "." << std::endl;
         std::cout << "VITALITY: " << combat_queue_.front()->getVitality() << std::endl;
         std::cout << "ARMOR: " << combat_queue_.front()->getArmor() << std::endl;
-        combat_queue_.pop();
+        popCombatQueue();
     }
 }
 
@@ -544,6 +596,7 @@ combat queue.
 */
 void Tavern::turnResolution()
 {
+    RPG_TIME_SCOPE("Tavern::turnResolution");
     if (main_character_->getActionQueue()->empty() || combat_queue_.empty())
     {
         return;
@@ -645,8 +698,8 @@ void Tavern::printTurnResolution() // used to print the results of the actions
     {
         std::cout << getTarget()->getName() << " "
                   << "DEFEATED" << std::endl;
-        exitTavern(combat_queue_.front());
-        combat_queue_.pop();
+        exitTavern(combat_handles_.front()); // O(1): no search for the defeated enemy
+        popCombatQueue();
     }
 }
 
@@ -671,8 +724,8 @@ void Tavern::printTurnResolutionBuff() // used to print the results of the buff
     {
         std::cout << getTarget()->getName() << " "
                   << "DEFEATED" << std::endl;
-        exitTavern(combat_queue_.front());
-        combat_queue_.pop();
+        exitTavern(combat_handles_.front()); // O(1): no search for the defeated enemy
+        popCombatQueue();
     }
 }
 
@@ -723,6 +776,7 @@ Print out the results of the action as described below.
 */
 void Tavern::enemyTurn(Character *enemy)
 {
+    RPG_TIME_SCOPE("Tavern::enemyTurn");
     int random = (int)time(nullptr); // converts time to an int value based on current time
     srand(random);                   // sets the initial state of numbers to be randomly generated
     int randomNumber = rand() % 4;   // uses random number generator to generate random number between 0 and 3.
@@ -830,8 +884,11 @@ in the combat queue, do the following:
 */
 void Tavern::combat()
 {
+    RPG_TIME_SCOPE("Tavern::combat");
+    RPG_ALLOCATION_SCOPE("Tavern::combat");
     while ((main_character_->getVitality() > 0) && !(combat_queue_.empty()))
     {
+        RPG_COUNT("Tavern::combat round");
         actionSelection();
         turnResolution();
         enemyTurn(combat_queue_.front());
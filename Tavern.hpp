@@ -13,6 +13,8 @@
 #include "Barbarian.hpp"
 #include "Ranger.hpp"
 #include "Scoundrel.hpp"
+#include "Instrumentation.hpp"
+#include "TavernView.hpp"
 #include <vector>
 #include <iostream>
 #include <cmath>
@@ -26,6 +28,12 @@ public:
   /** Default Constructor **/
   Tavern();
 
+  /**
+   @param: the most characters the tavern may hold, instead of ArrayBag's DEFAULT_CAPACITY
+   @post: an empty tavern; its storage grows as characters enter, so a large capacity costs nothing until it is used
+  */
+  explicit Tavern(int capacity);
+
   /**
    @param: the name of an input file
   @pre: Formatting of the csv file is as follows (each numbered item appears separated by comma, only one value for each numbered item):
@@ -57,6 +65,12 @@ public:
   **/
   bool exitTavern(Character *a_character);
 
+  /** @param:   The handle the Character got when it entered the Tavern (see ArrayBag::add and ArrayBag::getHandle)
+      @return:  returns true if the character was still in the Tavern and was removed, false otherwise
+      @post:    removes the character in O(1), without searching items_, and updates the level sum and the enemy count.
+  **/
+  bool exitTavern(const BagHandle &handle);
+
   /**
   @return:  The integer level count of all the characters currently in the Tavern
   **/
@@ -103,6 +117,13 @@ public:
   */
   void tavernReport();
 
+  /**
+    @param: a filter, by default one every character matches
+    @return: a lazily filtered view of the characters in the tavern, which copies and prints nothing.
+             Narrow it with race, subclass, enemies and levels, e.g. characters().subclass(MAGE).enemies()
+  */
+  TavernView characters(const CharacterFilter &filter = CharacterFilter()) const;
+
   /**
     @post: For every character in the tavern, displays each character's information
   */
@@ -116,10 +137,17 @@ public:
   void displayRace(const std::string &race);
 
   /**
-    @post: Every character in the tavern eats a tainted stew.
+    @post: Every character in the tavern eats a tainted stew, drawing any chance from the tavern's own generator.
   */
   void taintedStew();
 
+  /**
+    @param: a seed
+    @post: restarts the tavern's random number generator from the seed. A new tavern starts from std::mt19937's default
+           seed, so the same taverns given the same seeds always have the same stews, whichever thread serves them.
+  */
+  void seedRandom(unsigned seed);
+
   /**
     @param: a Character pointer
     @post: sets the Tavern's main character to the pointer that is given
@@ -172,6 +200,11 @@ public:
   */
   Character *getTarget() const;
 
+  /**
+  @return : the number of enemies waiting in the Combat Queue
+  */
+  int getCombatQueueSize() const;
+
   /**
   @post : Prints the details of each character in the combat queue in the following form:
         : [ENEMY NAME]: LEVEL [ENEMY LEVEL] [ENEMY RACE]. \nVITALITY: [ENEMY VITALITY] \nARMOR: [ENEMY ARMOR]\n
@@ -285,5 +318,10 @@ private:
   std::string input_file_name_;          // The name of the input file
   Character *main_character_;            // A pointer to a main character.
   std::queue<Character *> combat_queue_; // A combat queue of Character pointers, enemies that the main character must fight.
+  std::queue<BagHandle> combat_handles_; // The handle of each enemy in combat_queue_, in the same order, so a defeated enemy leaves in O(1).
+  std::mt19937 random_;                  // The tavern's own random number generator, so taverns served in parallel never share one.
+
+  // Helper function: removes the front of combat_queue_ and combat_handles_
+  void popCombatQueue();
 };
 #endif
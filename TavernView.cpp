@@ -0,0 +1,171 @@
+/*
+ * File Title: TavernView.cpp
+ * Author: Mahim Ali
+ * Date: October 19, 2026
+ * This file implements a class called TavernView
+ */
+#include "TavernView.hpp"
+
+/*
+    @param: a Character pointer
+    @return: true if the character passes every condition of the filter
+*/
+bool CharacterFilter::matches(const Character *character) const
+{
+    // the cheap conditions go first, the virtual call last
+    int level = character->getLevel();
+    return level >= min_level_ && level <= max_level_ &&
+           (race_ == NONE || character->getRaceType() == race_) &&
+           (enemy_ < 0 || character->isEnemy() == (enemy_ == 1)) &&
+           (subclass_ == NO_SUBCLASS || character->getSubclass() == subclass_);
+}
+
+/*
+    @param: the position to start from, the end of the characters, and the filter they must pass
+    @post: the iterator is at the first matching character from current on
+*/
+TavernView::iterator::iterator(Character *const *current, Character *const *end, const CharacterFilter &filter)
+    : current_{current}, end_{end}, filter_{filter}
+{
+    skip();
+}
+
+/*
+    @post: moves to the next matching character
+*/
+TavernView::iterator &TavernView::iterator::operator++()
+{
+    current_++;
+    skip();
+    return *this;
+}
+
+TavernView::iterator TavernView::iterator::operator++(int)
+{
+    iterator previous = *this;
+    ++*this;
+    return previous;
+}
+
+// Helper function: moves current_ forward to the first matching character, or to end_
+void TavernView::iterator::skip()
+{
+    while (current_ != end_ && !filter_.matches(*current_))
+    {
+        current_++;
+    }
+}
+
+/*
+    @param: the characters to walk and the filter they must pass
+*/
+TavernView::TavernView(const ArrayBagView<Character *> &characters, const CharacterFilter &filter)
+    : characters_{characters}, filter_{filter}
+{
+}
+
+TavernView::iterator TavernView::begin() const
+{
+    return iterator(characters_.begin(), characters_.end(), filter_);
+}
+
+TavernView::iterator TavernView::end() const
+{
+    return iterator(characters_.end(), characters_.end(), filter_);
+}
+
+/*
+    @return: the number of matching characters
+*/
+int TavernView::count() const
+{
+    int matching = 0;
+    for (Character *character : characters_)
+    {
+        matching += filter_.matches(character);
+    }
+    return matching;
+}
+
+/*
+    @return: true if no character matches
+*/
+bool TavernView::empty() const
+{
+    return begin() == end();
+}
+
+/*
+    @return: the first matching character, nullptr if there is none
+*/
+Character *TavernView::front() const
+{
+    iterator first = begin();
+    return (first != end()) ? *first : nullptr;
+}
+
+/*
+    @return: a view of the characters of this view that also are of the race
+*/
+TavernView TavernView::race(Race race) const
+{
+    if (race == NONE || race == filter_.race_)
+    {
+        return *this;
+    }
+    TavernView narrowed = (filter_.race_ == NONE) ? *this : none();
+    narrowed.filter_.race_ = race;
+    return narrowed;
+}
+
+/*
+    @return: a view of the characters of this view that also are of the subclass
+*/
+TavernView TavernView::subclass(Subclass subclass) const
+{
+    if (subclass == NO_SUBCLASS || subclass == filter_.subclass_)
+    {
+        return *this;
+    }
+    TavernView narrowed = (filter_.subclass_ == NO_SUBCLASS) ? *this : none();
+    narrowed.filter_.subclass_ = subclass;
+    return narrowed;
+}
+
+/*
+    @return: a view of the characters of this view that also are enemies (or are not, with false)
+*/
+TavernView TavernView::enemies(bool enemy) const
+{
+    TavernView narrowed = (filter_.enemy_ < 0 || filter_.enemy_ == (enemy ? 1 : 0)) ? *this : none();
+    narrowed.filter_.enemy_ = enemy ? 1 : 0;
+    return narrowed;
+}
+
+/*
+    @return: a view of the characters of this view that also are of a level in [min_level, max_level]
+*/
+TavernView TavernView::levels(int min_level, int max_level) const
+{
+    TavernView narrowed = *this;
+    narrowed.filter_.min_level_ = std::max(narrowed.filter_.min_level_, min_level);
+    narrowed.filter_.max_level_ = std::min(narrowed.filter_.max_level_, max_level);
+    return narrowed;
+}
+
+// Helper function: a view of the same characters that lets none through, for contradicting conditions
+TavernView TavernView::none() const
+{
+    TavernView nothing = *this;
+    nothing.filter_.min_level_ = INT_MAX;
+    nothing.filter_.max_level_ = INT_MIN;
+    return nothing;
+}
+
+/*
+    @return: the filter of the view
+*/
+const CharacterFilter &TavernView::getFilter() const
+{
+    return filter_;
+}
@@ -0,0 +1,110 @@
+/*
+ * File Title: TavernView.hpp
+ * Author: Mahim Ali
+ * Date: October 19, 2026
+ * This file is the interface of a class called TavernView
+ */
+#ifndef TAVERN_VIEW_HPP
+#define TAVERN_VIEW_HPP
+#include <climits>
+#include <iterator>
+#include "ArrayBag.hpp"
+#include "Character.hpp"
+
+/*
+    Which characters a TavernView lets through. By default every character matches.
+*/
+struct CharacterFilter
+{
+    Race race_ = NONE;                // NONE: any race
+    Subclass subclass_ = NO_SUBCLASS; // NO_SUBCLASS: any subclass
+    int enemy_ = -1;                  // -1: anyone, 0: only characters that are not enemies, 1: only enemies
+    int min_level_ = INT_MIN;
+    int max_level_ = INT_MAX;
+
+    /*
+    @param: a Character pointer
+    @return: true if the character passes every condition of the filter
+    */
+    bool matches(const Character *character) const;
+};
+
+/*
+    A lazily filtered range over the characters of a Tavern (see Tavern::characters). Nothing is copied and
+    nothing is printed: each character is tested only as the range is walked.
+    Narrowing functions return a new view, so conditions can be chained:
+        for (Character *enemy : tavern.characters().race(ELF).enemies().levels(5, 10)) ...
+    Like ArrayBagView, a view is invalidated when a character enters or leaves the tavern.
+*/
+class TavernView
+{
+public:
+    class iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Character *;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Character *const *;
+        using reference = Character *const &;
+
+        iterator(Character *const *current, Character *const *end, const CharacterFilter &filter);
+
+        reference operator*() const { return *current_; }
+        pointer operator->() const { return current_; }
+        iterator &operator++();
+        iterator operator++(int);
+        bool operator==(const iterator &rhs) const { return current_ == rhs.current_; }
+        bool operator!=(const iterator &rhs) const { return current_ != rhs.current_; }
+
+    private:
+        Character *const *current_; // a matching character, or end_
+        Character *const *end_;
+        CharacterFilter filter_; // a copy, so the iterator outlives a temporary view
+
+        // Helper function: moves current_ forward to the first matching character, or to end_
+        void skip();
+    };
+
+    /*
+    @param: the characters to walk and the filter they must pass
+    */
+    TavernView(const ArrayBagView<Character *> &characters, const CharacterFilter &filter = CharacterFilter());
+
+    iterator begin() const;
+    iterator end() const;
+
+    /*
+    @return: the number of matching characters, and whether there are none (this walks the range)
+    */
+    int count() const;
+    bool empty() const;
+
+    /*
+    @return: the first matching character, nullptr if there is none
+    */
+    Character *front() const;
+
+    /*
+    @return: a view of the characters of this view that also are of the race, of the subclass,
+             enemies (or not, with false), or of a level in [min_level, max_level]
+    */
+    TavernView race(Race race) const;
+    TavernView subclass(Subclass subclass) const;
+    TavernView enemies(bool enemy = true) const;
+    TavernView levels(int min_level, int max_level) const;
+
+    /*
+    @return: the filter of the view
+    */
+    const CharacterFilter &getFilter() const;
+
+private:
+    ArrayBagView<Character *> characters_;
+    CharacterFilter filter_;
+
+    // Helper function: a view of the same characters that lets none through, for contradicting conditions
+    TavernView none() const;
+};
+
+#endif
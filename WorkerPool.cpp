@@ -0,0 +1,96 @@
+/*
+ * File Title: WorkerPool.cpp
+ * Author: Mahim Ali
+ * Date: October 19, 2026
+ * This file implements a class called WorkerPool
+ */
+#include "WorkerPool.hpp"
+#include <algorithm>
+
+/*
+    @param: the number of threads that share the work, the calling thread included (at least 1)
+*/
+WorkerPool::WorkerPool(unsigned workers) : worker_count_{std::max(1u, workers)}, job_{nullptr}, generation_{0}, pending_{0}, stopping_{false}
+{
+    for (unsigned shard = 1; shard < worker_count_; shard++)
+    {
+        workers_.emplace_back(&WorkerPool::workerLoop, this, shard);
+    }
+}
+
+/*
+    @post: stops and joins the workers
+*/
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    start_.notify_all();
+    for (std::thread &worker : workers_)
+    {
+        worker.join();
+    }
+}
+
+/*
+    @return: the number of threads that share the work, the calling thread included
+*/
+unsigned WorkerPool::getWorkerCount() const
+{
+    return worker_count_;
+}
+
+/*
+    @param: a job to call with the number of every shard
+    @post: calls job(shard) for every shard, shard 0 on the calling thread, and waits for all
+*/
+void WorkerPool::runShards(const std::function<void(unsigned)> &job)
+{
+    if (worker_count_ == 1)
+    {
+        job(0);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        job_ = &job;
+        pending_ = worker_count_ - 1;
+        generation_++;
+    }
+    start_.notify_all();
+    job(0);
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this]
+               { return pending_ == 0; });
+    job_ = nullptr;
+}
+
+/*
+    @param: the number of the shard this worker runs
+    @post: runs the shard of every job posted until the pool stops
+*/
+void WorkerPool::workerLoop(unsigned shard)
+{
+    unsigned long long seen = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        start_.wait(lock, [&]
+                    { return stopping_ || generation_ != seen; });
+        if (stopping_)
+        {
+            return;
+        }
+        seen = generation_;
+        const std::function<void(unsigned)> *job = job_;
+        lock.unlock();
+        (*job)(shard);
+        lock.lock();
+        if (--pending_ == 0)
+        {
+            done_.notify_one();
+        }
+    }
+}
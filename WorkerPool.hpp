@@ -0,0 +1,63 @@
+/*
+ * File Title: WorkerPool.hpp
+ * Author: Mahim Ali
+ * Date: October 19, 2026
+ * This file is the interface of a class called WorkerPool
+ */
+#ifndef WORKER_POOL_HPP
+#define WORKER_POOL_HPP
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+    A fixed set of threads that run one job at a time, split into shards.
+
+    The threads are started once, by the constructor, and wait between jobs; the calling thread runs the first shard
+    itself, so a pool of one thread starts none. Used by World for its taverns and by QuestList::calculateAllExperience.
+*/
+class WorkerPool
+{
+public:
+    /*
+    @param: the number of threads that share the work, the calling thread included (at least 1)
+    */
+    WorkerPool(unsigned workers = std::thread::hardware_concurrency());
+
+    /*
+    @post: stops and joins the workers
+    */
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    /*
+    @return: the number of threads that share the work, the calling thread included
+    */
+    unsigned getWorkerCount() const;
+
+    /*
+    @param: a job to call with the number of every shard
+    @post: calls job(shard) for every shard in [0, getWorkerCount()), shard 0 on the calling thread, and waits for all.
+           Only one thread may run jobs on a pool at a time.
+    */
+    void runShards(const std::function<void(unsigned)> &job);
+
+private:
+    unsigned worker_count_;             // threads sharing the work, the calling thread included
+    std::vector<std::thread> workers_;  // worker_count_ - 1 threads, for shards 1 and up
+    std::mutex mutex_;                  // guards everything below
+    std::condition_variable start_;     // signalled when a new job is posted or the workers must stop
+    std::condition_variable done_;      // signalled when the last worker finishes a job
+    const std::function<void(unsigned)> *job_; // the current job, called with the number of a shard
+    unsigned long long generation_;     // number of jobs posted so far
+    unsigned pending_;                  // workers still busy with the current job
+    bool stopping_;
+
+    // Helper Function: the loop of the worker that runs the given shard
+    void workerLoop(unsigned shard);
+};
+#endif // WORKER_POOL_HPP
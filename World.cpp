@@ -0,0 +1,235 @@
+/*
+ * File Title: World.cpp
+ * Author: Mahim Ali
+ * Date: October 19, 2026
+ * This file implements a class called World
+ */
+#include "World.hpp"
+
+/*
+    @param: the totals of another group of taverns
+    @post: adds them to these totals
+*/
+void WorldStatistics::merge(const WorldStatistics &other)
+{
+    taverns_ += other.taverns_;
+    characters_ += other.characters_;
+    enemies_ += other.enemies_;
+    level_sum_ += other.level_sum_;
+    for (int race = 0; race < 6; race++)
+    {
+        race_counts_[race] += other.race_counts_[race];
+    }
+    combat_queued_ += other.combat_queued_;
+    migrating_ += other.migrating_;
+}
+
+/*
+    @param: the number of threads that share the work, the calling thread included (at least 1)
+*/
+World::World(unsigned workers) : migrating_{0}, pool_{workers}
+{
+}
+
+/*
+    @post: stops the workers and deletes every tavern and every Character in them
+*/
+World::~World()
+{
+    for (std::unique_ptr<Tavern> &tavern : taverns_)
+    {
+        for (Character *character : tavern->view())
+        {
+            delete character;
+        }
+    }
+    Character *character;
+    size_t from;
+    for (std::unique_ptr<MigrationQueue> &inbox : inboxes_) // Characters still on their way
+    {
+        while (inbox->receive(character, from))
+        {
+            delete character;
+        }
+    }
+}
+
+/*
+    @return: a new empty tavern, owned by the World, its random number generator seeded with its index
+*/
+Tavern &World::addTavern()
+{
+    taverns_.push_back(std::make_unique<Tavern>());
+    taverns_.back()->seedRandom(taverns_.size() - 1);
+    inboxes_.push_back(std::make_unique<MigrationQueue>());
+    return *taverns_.back();
+}
+
+/*
+    @param: the name of a tavern csv file
+    @return: a new tavern loaded from the file, owned by the World, its random number generator seeded with its index
+*/
+Tavern &World::addTavern(const std::string &input_file_name)
+{
+    taverns_.push_back(std::make_unique<Tavern>(input_file_name));
+    taverns_.back()->seedRandom(taverns_.size() - 1);
+    inboxes_.push_back(std::make_unique<MigrationQueue>());
+    return *taverns_.back();
+}
+
+/*
+    @return: the number of taverns
+*/
+size_t World::getTavernCount() const
+{
+    return taverns_.size();
+}
+
+/*
+    @return: the tavern at an index
+*/
+Tavern &World::getTavern(size_t index)
+{
+    return *taverns_[index];
+}
+
+/*
+    @return: the number of threads that share the work, the calling thread included
+*/
+unsigned World::getWorkerCount() const
+{
+    return pool_.getWorkerCount();
+}
+
+/*
+    @param: the number of a shard
+    @return: the index of the first tavern of the shard
+*/
+size_t World::shardBegin(unsigned shard) const
+{
+    return taverns_.size() * shard / pool_.getWorkerCount();
+}
+
+/*
+    @param: work to do on a tavern
+    @post: calls work on every tavern, spread over the workers, and returns when all are done
+*/
+void World::forEachTavern(const std::function<void(Tavern &)> &work)
+{
+    pool_.runShards([&](unsigned shard)
+                    {
+                        for (size_t i = shardBegin(shard); i < shardBegin(shard + 1); i++)
+                        {
+                            work(*taverns_[i]);
+                        } });
+}
+
+/*
+    @post: every character in every tavern eats a tainted stew, in parallel
+*/
+void World::serveTaintedStew()
+{
+    forEachTavern([](Tavern &tavern)
+                  { tavern.taintedStew(); });
+}
+
+/*
+    @param: a combat queue filter, as taken by Tavern::createCombatQueue
+    @post: rebuilds the combat queue of every tavern, in parallel
+*/
+void World::prepareCombat(const std::string &combat_filter)
+{
+    forEachTavern([&](Tavern &tavern)
+                  { tavern.createCombatQueue(combat_filter); });
+}
+
+/*
+    @return: the totals of every tavern, counted in parallel
+*/
+WorldStatistics World::getStatistics()
+{
+    std::vector<WorldStatistics> shards(pool_.getWorkerCount()); // one per shard, so the workers never write the same totals
+    pool_.runShards([&](unsigned shard)
+                    {
+                        WorldStatistics totals;
+                        for (size_t i = shardBegin(shard); i < shardBegin(shard + 1); i++)
+                        {
+                            Tavern &tavern = *taverns_[i];
+                            totals.taverns_++;
+                            totals.characters_ += tavern.getCurrentSize();
+                            totals.enemies_ += tavern.getEnemyCount();
+                            totals.level_sum_ += tavern.getLevelSum();
+                            totals.combat_queued_ += tavern.getCombatQueueSize();
+                            for (Character *character : tavern.view())
+                            {
+                                totals.race_counts_[character->getRaceType()]++;
+                            }
+                        }
+                        shards[shard] = totals; });
+    WorldStatistics world;
+    for (const WorldStatistics &totals : shards)
+    {
+        world.merge(totals);
+    }
+    world.migrating_ = migrating_.load(std::memory_order_relaxed);
+    return world;
+}
+
+/*
+    @param: the index of the tavern a Character is in, the index of the tavern it moves to, and the Character
+    @return: true if the Character was in tavern from; it has left and arrives at the next applyMigrations()
+*/
+bool World::migrate(size_t from, size_t to, Character *character)
+{
+    if (from == to || !taverns_[from]->exitTavern(character))
+    {
+        return false;
+    }
+    migrating_.fetch_add(1, std::memory_order_relaxed);
+    inboxes_[to]->post(character, from);
+    return true;
+}
+
+/*
+    @return: the number of Characters that entered their new tavern
+    @post: every tavern takes in the Characters posted to it, in parallel
+*/
+long long World::applyMigrations()
+{
+    std::vector<long long> arrivals(pool_.getWorkerCount());
+    pool_.runShards([&](unsigned shard)
+                    {
+                        long long arrived = 0;
+                        std::vector<std::pair<Character *, size_t>> refused;
+                        for (size_t i = shardBegin(shard); i < shardBegin(shard + 1); i++)
+                        {
+                            Character *character;
+                            size_t from;
+                            while (inboxes_[i]->receive(character, from))
+                            {
+                                if (taverns_[i]->enterTavern(character))
+                                {
+                                    arrived++;
+                                }
+                                else
+                                {
+                                    refused.push_back({character, from});
+                                }
+                            }
+                            // sent back only once this inbox is drained, so two full taverns cannot pass a Character back
+                            // and forth forever within one tick
+                            for (const std::pair<Character *, size_t> &back : refused)
+                            {
+                                inboxes_[back.second]->post(back.first, i);
+                            }
+                            refused.clear();
+                        }
+                        migrating_.fetch_sub(arrived, std::memory_order_relaxed);
+                        arrivals[shard] = arrived; });
+    long long arrived = 0;
+    for (long long count : arrivals)
+    {
+        arrived += count;
+    }
+    return arrived;
+}
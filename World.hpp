@@ -0,0 +1,143 @@
+/*
+ * File Title: World.hpp
+ * Author: Mahim Ali
+ * Date: October 19, 2026
+ * This file is the interface of a class called World
+ */
+#ifndef WORLD_HPP
+#define WORLD_HPP
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Tavern.hpp"
+#include "MigrationQueue.hpp"
+#include "WorkerPool.hpp"
+
+/*
+    Totals over every tavern of a World.
+*/
+struct WorldStatistics
+{
+    long long taverns_ = 0;         // number of taverns
+    long long characters_ = 0;      // characters in all taverns
+    long long enemies_ = 0;         // characters marked as enemies
+    long long level_sum_ = 0;       // sum of the levels of all characters
+    long long race_counts_[6] = {}; // characters of each Race, indexed by the enum value
+    long long combat_queued_ = 0;   // enemies waiting in the combat queues
+    long long migrating_ = 0;       // characters that have left a tavern and not yet arrived in another
+
+    /*
+    @param: the totals of another group of taverns
+    @post: adds them to these totals
+    */
+    void merge(const WorldStatistics &other);
+};
+
+/*
+    Owns many Taverns and the Characters in them, and runs work on every tavern in parallel.
+
+    The taverns are split into one contiguous shard per worker, and each worker only touches the taverns of its shard,
+    so no locks are needed as long as a Character is in at most one tavern. The workers are a WorkerPool, started once
+    by the constructor, that waits between calls; the calling thread works on the first shard itself.
+    Characters move between taverns in two phases. migrate() takes a Character out of its tavern at once and posts it
+    to the inbox of the destination (a MigrationQueue), which any thread may do; applyMigrations() is the tick boundary
+    where every tavern's owner takes in its inbox. The level sum and enemy count of both taverns are kept by
+    Tavern::exitTavern and Tavern::enterTavern, so they always describe the characters actually inside.
+
+    Tavern::combat and Tavern::tavernReport read std::cin and write std::cout, which all threads share, so they are
+    not run here: combats are prepared in parallel (prepareCombat) and fought one tavern at a time.
+*/
+class World
+{
+public:
+    /*
+    @param: the number of threads that share the work, the calling thread included (at least 1)
+    */
+    World(unsigned workers = std::thread::hardware_concurrency());
+
+    /*
+    @post: stops the workers and deletes every tavern and every Character in them
+    */
+    ~World();
+
+    World(const World &) = delete;
+    World &operator=(const World &) = delete;
+
+    /*
+    @return: a new empty tavern, owned by the World
+    */
+    Tavern &addTavern();
+
+    /*
+    @param: the name of a tavern csv file
+    @return: a new tavern loaded from the file, owned by the World
+    */
+    Tavern &addTavern(const std::string &input_file_name);
+
+    /*
+    @return: the number of taverns, and the tavern at an index
+    */
+    size_t getTavernCount() const;
+    Tavern &getTavern(size_t index);
+
+    /*
+    @return: the number of threads that share the work, the calling thread included
+    */
+    unsigned getWorkerCount() const;
+
+    /*
+    @param: work to do on a tavern
+    @post: calls work on every tavern, spread over the workers, and returns when all are done.
+           work may be called on different taverns at the same time, so it may only touch the tavern it is given.
+    */
+    void forEachTavern(const std::function<void(Tavern &)> &work);
+
+    /*
+    @post: every character in every tavern eats a tainted stew (Tavern::taintedStew), in parallel. Each tavern draws
+           from its own generator, seeded with its index by addTavern, so the outcome does not depend on the threads.
+    */
+    void serveTaintedStew();
+
+    /*
+    @param: a combat queue filter, as taken by Tavern::createCombatQueue
+    @post: rebuilds the combat queue of every tavern, in parallel
+    */
+    void prepareCombat(const std::string &combat_filter = "NONE");
+
+    /*
+    @return: the totals of every tavern, counted in parallel (each worker counts its shard, then the shards are merged)
+    */
+    WorldStatistics getStatistics();
+
+    /*
+    @param: the index of the tavern a Character is in, the index of the tavern it moves to, and the Character
+    @pre: called by the thread that owns tavern from: inside forEachTavern work on that tavern, or outside any job
+    @return: true if the Character was in tavern from; it has left and arrives at the next applyMigrations().
+             False, changing nothing, if it was not there or from and to are the same.
+    */
+    bool migrate(size_t from, size_t to, Character *character);
+
+    /*
+    @pre: not called from inside forEachTavern work
+    @return: the number of Characters that entered their new tavern
+    @post: every tavern takes in the Characters posted to it, in parallel. A Character whose destination is full is
+           sent back to the tavern it came from, and arrives there at this or a later applyMigrations().
+    */
+    long long applyMigrations();
+
+private:
+    std::vector<std::unique_ptr<Tavern>> taverns_;
+    std::vector<std::unique_ptr<MigrationQueue>> inboxes_; // inboxes_[i] holds the Characters on their way to taverns_[i]
+    std::atomic<long long> migrating_;  // Characters posted and not yet arrived
+    WorkerPool pool_;                   // one shard of taverns per thread
+
+    /*
+    @param: the number of a shard
+    @return: the index of the first tavern of the shard; the shard ends where the next one begins
+    */
+    size_t shardBegin(unsigned shard) const;
+};
+#endif // WORLD_HPP
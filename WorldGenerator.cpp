@@ -0,0 +1,114 @@
+/*
+ * File Title: WorldGenerator.cpp
+ * Author: Mahim Ali
+ * Date: October 19, 2026
+ * This file is a command line tool that writes synthetic tavern, quest and item csv files for load testing.
+ * Build: make world_generator
+ */
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DataGenerator.hpp"
+
+/**
+    @post: prints how the tool is used and exits with an error.
+*/
+void usage()
+{
+    std::cerr << "Usage: world_generator tavern|quests|items ROWS [options]\n"
+              << "Options:\n"
+              << "  -o FILE               write to FILE instead of standard output\n"
+              << "  --seed N              seed of the generator (default 2023); the same seed always gives the same file\n"
+              << "Quest graph options:\n"
+              << "  --dependencies N      most dependencies a quest lists (default 2)\n"
+              << "  --subquests N         most subquests a quest lists (default 2)\n"
+              << "  --subquest-every N    every N-th quest lists subquests, 0 for none (default 3)\n"
+              << "  --chains N            number of independent dependency chains (default 1)\n"
+              << "  --window N            dependencies and subquests come from the N quests before, 0 for any (default 0)\n"
+              << "  --undiscovered P      percent of subquests that never get their own row (default 50)\n"
+              << "A Tavern holds at most 100 characters; larger tavern files are for measuring the csv reader." << std::endl;
+    exit(1);
+}
+
+/**
+    @param: a command line argument
+    @return: the argument as a non-negative integer; prints the usage if it is not one
+*/
+int readCount(const std::string &argument)
+{
+    if (argument.empty() || argument.find_first_not_of("0123456789") != std::string::npos)
+    {
+        usage();
+    }
+    return std::stoi(argument);
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        usage();
+    }
+    std::string kind = argv[1];
+    int rows = readCount(argv[2]);
+    std::string output_file_name;
+    unsigned seed = 2023;
+    QuestShape shape;
+    for (int i = 3; i < argc; i++)
+    {
+        std::string option = argv[i];
+        if (i + 1 == argc)
+        {
+            usage(); // every option takes a value
+        }
+        std::string value = argv[++i];
+        if (option == "-o")
+            output_file_name = value;
+        else if (option == "--seed")
+            seed = readCount(value);
+        else if (option == "--dependencies")
+            shape.max_dependencies_ = readCount(value);
+        else if (option == "--subquests")
+            shape.max_subquests_ = readCount(value);
+        else if (option == "--subquest-every")
+            shape.subquest_every_ = readCount(value);
+        else if (option == "--chains")
+            shape.chains_ = readCount(value);
+        else if (option == "--window")
+            shape.window_ = readCount(value);
+        else if (option == "--undiscovered")
+            shape.undiscovered_percent_ = readCount(value);
+        else
+            usage();
+    }
+
+    // rows are streamed through a large buffer, so memory use does not grow with the number of rows
+    std::ios::sync_with_stdio(false);
+    std::vector<char> buffer(1 << 20);
+    std::ofstream fout;
+    if (!output_file_name.empty())
+    {
+        fout.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+        fout.open(output_file_name);
+        if (fout.fail())
+        {
+            std::cerr << "File cannot be opened for writing." << std::endl;
+            exit(1);
+        }
+    }
+    std::ostream &out = output_file_name.empty() ? std::cout : fout;
+
+    DataGenerator generator(seed);
+    if (kind == "tavern")
+        generator.writeTavern(out, rows);
+    else if (kind == "quests")
+        generator.writeQuests(out, rows, shape);
+    else if (kind == "items")
+        generator.writeItems(out, rows);
+    else
+        usage();
+    out.flush();
+    return 0;
+}